@@ -0,0 +1,352 @@
+/* Detection kernel microbenchmarks
+ *
+ * Times every stage of the detection pipeline over several frame and buffer sizes: RGB565 conversion,
+ * histogram and projections with the gates, the same through internal RAM tiles, resize, background
+ * model update, the JPEG encode of stored shots, JPEG DC luminance, frame log coding, clap detection,
+ * the recorder's audio coding and an event queue round trip. Each line gives ms percentiles and the
+ * median cost per byte of input.
+ *
+ * On the device it runs instead of the firmware (CONFIG_EXAMPLE_BENCHMARK). The same file builds for
+ * Linux against the same detector sources (host/CMakeLists.txt), where the cycle counter counts
+ * nanoseconds and there is no JPEG encoder.
+ */
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <esp_camera.h>
+#include <sdkconfig.h>
+#include "AudioDetector.h"
+#include "VisualDetector.h"
+#include "Util/Queue.h"
+#include "Util/Timer.h"
+#include "Util/AudioCodec.h"
+#include "Util/FrameCodec.h"
+#include "Util/JpegDc.h"
+#include "Util/Memory.h"
+#include "Util/TileStream.h"
+#include "Util/Image.h"
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <cstdio>
+#include <cstring>
+
+#ifdef ESP_PLATFORM
+static constexpr const char* CycleUnit = "cyc/B";
+#else
+static constexpr const char* CycleUnit = "ns/B";
+#endif
+
+struct FrameSize {
+	const char* name;
+	uint32_t width, height;
+};
+
+static constexpr FrameSize FrameSizes[] = {
+		{ "96x96", 96,  96 },
+		{ "QQVGA", 160, 120 },
+		{ "HQVGA", 240, 176 },
+		{ "QVGA",  320, 240 }
+};
+
+static constexpr size_t AudioBuffers[] = { 1024, 4096, 16000 }; //[samples]
+
+static constexpr uint32_t DetectorWidth = 160, DetectorHeight = 120; //resize target, size VisualDetector works on
+
+static std::vector<uint32_t> samples;
+
+/**
+ * Times 'iterations' runs of 'kernel' after one warm-up run and prints a result line.
+ * @param bytes input size of one run
+ */
+template<typename F>
+static void measure(const char* kernel, const char* size, size_t bytes, size_t iterations, F&& run){
+	samples.resize(iterations);
+
+	run();
+	for(size_t i = 0; i < iterations; i++){
+		Stopwatch stopwatch;
+		run();
+		samples[i] = stopwatch.elapsedCycles();
+	}
+
+	std::sort(samples.begin(), samples.end());
+	const auto percentile = [](size_t p){ return samples[std::min(samples.size() - 1, samples.size() * p / 100)]; };
+	const auto ms = [](uint32_t c){ return cyclesToMicros(c) / 1000.0f; };
+
+	printf("%-14s %-6s %7zu %8.3f %8.3f %8.3f %8.3f %8.2f\n", kernel, size, bytes,
+		   ms(percentile(50)), ms(percentile(90)), ms(percentile(99)), ms(samples.back()), (float) percentile(50) / bytes);
+
+	//give the idle task a chance, long runs would trip the task watchdog
+	vTaskDelay(1);
+}
+
+//Deterministic pseudo-random fill, so every run and platform times the same data
+static void fill(uint8_t* data, size_t size, uint32_t seed){
+	for(size_t i = 0; i < size; i++){
+		seed = seed * 1664525 + 1013904223;
+		data[i] = seed >> 24;
+	}
+}
+
+static void benchmarkFrames(const FrameSize& size){
+	const size_t pixels = size.width * size.height;
+
+	//frames come from the camera in PSRAM, keep the working set there as well
+	auto rgb = (uint8_t*) heap_caps_malloc(pixels * 2, MALLOC_CAP_SPIRAM);
+	auto gray0 = (uint8_t*) heap_caps_malloc(pixels, MALLOC_CAP_SPIRAM);
+	auto gray1 = (uint8_t*) heap_caps_malloc(pixels, MALLOC_CAP_SPIRAM);
+	if(!rgb || !gray0 || !gray1){
+		printf("%-14s %-6s out of memory\n", "frame", size.name);
+		heap_caps_free(rgb);
+		heap_caps_free(gray0);
+		heap_caps_free(gray1);
+		return;
+	}
+
+	fill(rgb, pixels * 2, 1);
+	VisualDetector::rgb565ToGray(rgb, gray0, pixels);
+
+	//second frame differs in about a quarter of the pixels, a detected change
+	memcpy(gray1, gray0, pixels);
+	for(size_t i = 0; i < pixels; i += 4){
+		gray1[i] += 40;
+	}
+
+	measure("rgb565ToGray", size.name, pixels * 2, 100, [&](){
+		VisualDetector::rgb565ToGray(rgb, gray0, pixels);
+	});
+
+	//conversion with the histogram and projections, and the gates a quiet frame stops at
+	const VisualDetector::Params params;
+	VisualDetector::FrameFeatures features(size.width, size.height), reference(size.width, size.height);
+	measure("gray+features", size.name, pixels * 2, 100, [&](){
+		VisualDetector::rgb565ToGray(rgb, gray0, features);
+	});
+
+	//the same with the frame streamed from PSRAM through two internal tiles, as the detector does
+	TileStream tiles(size.width * 2, 8, "benchmark tiles");
+	measure("gray+tiles", size.name, pixels * 2, 100, [&](){
+		tiles.start(rgb, size.height);
+		size_t y = 0, rows;
+		while(const uint8_t* tile = tiles.next(rows)){
+			VisualDetector::rgb565ToGray(tile, gray0 + y * size.width, features, y, rows);
+			y += rows;
+		}
+	});
+	VisualDetector::updateReference(features, reference, 0);
+	measure("gate", size.name, pixels, 100, [&](){
+		VisualDetector::gate(features, reference, params);
+	});
+
+	const ImageView frame0(gray0, size.width, size.height);
+
+	std::vector<uint8_t> scaled(DetectorWidth * DetectorHeight);
+	const ImageView detectorFrame(scaled.data(), DetectorWidth, DetectorHeight);
+	measure("scale", size.name, pixels, 100, [&](){
+		VisualDetector::scale(frame0, detectorFrame);
+	});
+	if(size.width > DetectorWidth && size.width % DetectorWidth == 0 && size.height % DetectorHeight == 0){
+		measure("scale box", size.name, pixels, 100, [&](){
+			Image::downscaleBox(frame0, detectorFrame);
+		});
+	}
+
+	//the frame difference the background model replaced, on the image kernels
+	std::vector<uint8_t> diff(pixels);
+	measure("diff+count", size.name, pixels, 100, [&](){
+		Image::absdiff(gray0, gray1, diff.data(), pixels);
+		Image::threshold(diff.data(), diff.data(), pixels, params.noiseCutoff, 255);
+		Image::countNonZero(diff.data(), pixels);
+		Image::sum(gray1, pixels);
+	});
+
+	//shape of that change, what a detection adds to the frame
+	if(size.width / VisualDetector::CellSize <= ComponentLabeller::MaxWidth){
+		std::vector<uint8_t> cells(pixels / (VisualDetector::CellSize * VisualDetector::CellSize));
+		ComponentLabeller labeller;
+		VideoEvent event{};
+		measure("components", size.name, pixels, 100, [&](){
+			VisualDetector::describeChange(ImageView(diff.data(), size.width, size.height), cells.data(), labeller, event);
+		});
+	}
+
+	//alternating frames, so every run updates the model with a quarter of the pixels changed. The model in PSRAM
+	//where malloc puts it, then in internal RAM where the detector places it.
+	uint32_t sum;
+	bool flash = false;
+	{
+		std::vector<VisualDetector::BackgroundPixel> background(pixels);
+		VisualDetector::initBackground(gray0, background.data(), pixels);
+		measure("background", size.name, pixels, 100, [&](){
+			VisualDetector::updateBackground(flash ? gray1 : gray0, background.data(), pixels, params, sum);
+			flash = !flash;
+		});
+	}
+	{
+		RegionBuffer<VisualDetector::BackgroundPixel> background(Memory::Region::Hot, pixels, "benchmark");
+		if(background.region() == Memory::Region::Hot){
+			VisualDetector::initBackground(gray0, background.data(), pixels);
+			measure("background hot", size.name, pixels, 100, [&](){
+				VisualDetector::updateBackground(flash ? gray1 : gray0, background.data(), pixels, params, sum);
+				flash = !flash;
+			});
+		}
+	}
+
+	//frame log: alternating frames, so every run codes a delta with a quarter of the pixels changed
+	FrameEncoder encoder(size.width, size.height);
+	std::vector<uint8_t> coded(encoder.maxOutput());
+	bool odd = false;
+	measure("frame encode", size.name, pixels, 100, [&](){
+		encoder.encode(odd ? gray1 : gray0, false, coded.data());
+		odd = !odd;
+	});
+
+	uint8_t* jpeg = nullptr;
+	size_t jpegLen = 0;
+	if(fmt2jpg(gray0, pixels, size.width, size.height, PIXFORMAT_GRAYSCALE, VisualDetector::ShotQuality, &jpeg, &jpegLen)){
+		free(jpeg);
+		measure("fmt2jpg", size.name, pixels, 20, [&](){
+			fmt2jpg(gray0, pixels, size.width, size.height, PIXFORMAT_GRAYSCALE, VisualDetector::ShotQuality, &jpeg, &jpegLen);
+			free(jpeg);
+		});
+	}else{
+		printf("%-14s %-6s no JPEG encoder\n", "fmt2jpg", size.name);
+	}
+
+	//camera frames in JPEG mode are colour, detected on the luminance of their block means
+	if(fmt2jpg(rgb, pixels * 2, size.width, size.height, PIXFORMAT_RGB565, 80, &jpeg, &jpegLen)){
+		auto decoder = std::make_unique<JpegDcDecoder>();
+		measure("jpeg dc", size.name, jpegLen, 100, [&](){
+			decoder->decode(jpeg, jpegLen);
+		});
+		free(jpeg);
+	}
+
+	heap_caps_free(rgb);
+	heap_caps_free(gray0);
+	heap_caps_free(gray1);
+}
+
+/**
+ * Hands out the same block on every read, so stepping AudioDetector times detectClap and a memcpy.
+ */
+class BlockSource : public AudioSource {
+public:
+	BlockSource(size_t count) : block(count){
+		//noise floor, with a clap-like spike and decay every 200 ms in the longer blocks
+		uint32_t seed = 7;
+		for(size_t i = 0; i < count; i++){
+			seed = seed * 1664525 + 1013904223;
+			block[i] = (int16_t) ((int32_t) (seed >> 24) - 128);
+		}
+		for(size_t start = 0; start + 1600 < count; start += 3200){
+			for(size_t i = 0; i < 1600; i++){
+				block[start + i] += (int16_t) (8000 / (1 + i / 16));
+			}
+		}
+	}
+
+	size_t read(int16_t* buffer, size_t count) override{
+		count = std::min(count, block.size());
+		memcpy(buffer, block.data(), count * sizeof(int16_t));
+		return count;
+	}
+
+	uint32_t getSampleRate() const override{
+		return 16000;
+	}
+
+private:
+	std::vector<int16_t> block;
+};
+
+static void benchmarkAudio(size_t bufferSize){
+	BlockSource source(bufferSize);
+	AudioDetector detector(&source, bufferSize);
+
+	char size[21];
+	snprintf(size, sizeof(size), "%zu", bufferSize);
+
+	//the warm-up run is the detector's calibration block
+	measure("detectClap", size, bufferSize * sizeof(int16_t), 100, [&](){
+		detector.step();
+	});
+}
+
+//One second of 16 kHz audio per run, so p50 ms / 10 is the percentage of a core the codec takes
+static void benchmarkCodec(){
+	static constexpr size_t Samples = 16000;
+	BlockSource source(Samples);
+	std::vector<int16_t> audio(Samples);
+	source.read(audio.data(), Samples);
+
+	static constexpr std::pair<const char*, AudioCodec> Codecs[] = {
+			{ "adpcm encode", AudioCodec::ImaAdpcm },
+			{ "lossless enc", AudioCodec::Lossless }
+	};
+
+	for(const auto& [name, codec] : Codecs){
+		//6 kB of state, too much for the benchmark task's stack
+		auto encoder = std::make_unique<AudioEncoder>(codec);
+		std::vector<uint8_t> coded(encoder->maxOutput(Samples));
+		measure(name, "16000", Samples * sizeof(int16_t), 20, [&](){
+			encoder->encode(audio.data(), Samples, coded.data());
+			encoder->flush(coded.data());
+		});
+	}
+}
+
+static void benchmarkQueue(){
+	Queue<SensorEvent> queue(16, "Bench");
+	VideoEvent video{};
+	video.intensity = 1;
+	SensorEvent event{ SensorEvent::Type::Video, 0, { .video = video }};
+
+	measure("queue post/get", "1", sizeof(SensorEvent), 1000, [&](){
+		queue.post(event, 0);
+		queue.get(event, 0);
+	});
+}
+
+static void benchmark(){
+	calibrateCycles();
+	esp_log_level_set("*", ESP_LOG_WARN);
+
+#ifdef ESP_PLATFORM
+	printf("CPU %d MHz, ", CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ);
+#endif
+	printf("%s = median cost per byte of input\n", CycleUnit);
+	printf("%-14s %-6s %7s %8s %8s %8s %8s %8s\n", "kernel", "size", "bytes", "p50 ms", "p90 ms", "p99 ms", "max ms", CycleUnit);
+
+	for(const auto& size : FrameSizes){
+		benchmarkFrames(size);
+	}
+	for(const auto bufferSize : AudioBuffers){
+		benchmarkAudio(bufferSize);
+	}
+	benchmarkCodec();
+	benchmarkQueue();
+
+	printf("done\n");
+}
+
+#ifdef ESP_PLATFORM
+//The cycle counter is per core, the benchmark task must not migrate. The frame kernels also need more than the main task's stack.
+static void benchmarkTask(void*){
+	benchmark();
+	vTaskDelete(nullptr);
+}
+
+extern "C" void app_main(void){
+	xTaskCreatePinnedToCore(benchmarkTask, "Benchmark", 16 * 1024, nullptr, 5, nullptr, 0);
+}
+#else
+int main(){
+	benchmark();
+	return 0;
+}
+#endif
@@ -0,0 +1,282 @@
+/* PDM microphone WAV recorder, based on the ESP-IDF I2S PDM recording example
+ *
+ * A reader task moves blocks from the microphone into a pool of buffers in PSRAM and a writer task writes
+ * them to SD through SDWriter. A slow card write only fills the pool for a while, instead of overrunning the
+ * I2S DMA buffers. WAV sizes are patched into the header when a file is closed. Audio is stored as PCM, IMA ADPCM
+ * or lossless (CONFIG_RECORDER_CODEC, Util/AudioCodec.h), coded by the writer task.
+ *
+ * By default it records CONFIG_RECORDER_TIME_S seconds into /sd/record.wav. In continuous mode
+ * (CONFIG_RECORDER_CONTINUOUS) it records indefinitely into /sd/recNNNNN.wav, starting the next file after
+ * CONFIG_RECORDER_FILE_MB or CONFIG_RECORDER_FILE_S without losing a sample in between. Throughput, the
+ * slowest write, coding time and ratio, pool usage and lost blocks are reported every CONFIG_RECORDER_REPORT_S.
+ */
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+#include "Periph/SD.h"
+#include "Periph/SDWriter.h"
+#include "Devices/Mic.h"
+#include "Util/Queue.h"
+#include "Util/Threaded.h"
+#include "Util/Timer.h"
+#include "Util/AudioCodec.h"
+#include "Pins.hpp"
+#include <atomic>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cinttypes>
+#include <sys/stat.h>
+
+static const char* TAG = "Recorder";
+
+static constexpr uint32_t SampleRate = CONFIG_RECORDER_SAMPLE_RATE;
+static constexpr size_t BlockSamples = 2048; //128 ms at 16 kHz, 43 ms at 48 kHz
+static constexpr size_t PoolBlocks = CONFIG_RECORDER_POOL_BLOCKS;
+
+#ifdef CONFIG_RECORDER_CONTINUOUS
+static constexpr uint64_t FileSamples = CONFIG_RECORDER_FILE_S > 0 ? (uint64_t) CONFIG_RECORDER_FILE_S * SampleRate : UINT64_MAX;
+static constexpr uint64_t FileBytes = CONFIG_RECORDER_FILE_MB * 1024ULL * 1024ULL; //coded data
+#else
+static constexpr uint64_t FileSamples = (uint64_t) CONFIG_RECORDER_TIME_S * SampleRate;
+static constexpr uint64_t FileBytes = UINT64_MAX;
+#endif
+
+#if defined(CONFIG_RECORDER_CODEC_ADPCM)
+static constexpr AudioCodec Codec = AudioCodec::ImaAdpcm;
+#elif defined(CONFIG_RECORDER_CODEC_LOSSLESS)
+static constexpr AudioCodec Codec = AudioCodec::Lossless;
+#else
+static constexpr AudioCodec Codec = AudioCodec::Pcm;
+#endif
+
+class Recorder {
+public:
+	Recorder(Mic& mic) : mic(mic), freeBlocks(PoolBlocks, "RecFree"), fullBlocks(PoolBlocks, "RecFull"), writer(32 * 1024),
+						 readThread([this](){ readBlock(); }, "RecRead", 3 * 1024, 10),
+						 writeThread([this](){ writeBlock(); }, "RecWrite", 4 * 1024, 5){}
+
+	bool start(){
+		pool = (int16_t*) heap_caps_malloc(PoolBlocks * BlockSamples * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+		spare = (int16_t*) heap_caps_malloc(BlockSamples * sizeof(int16_t), MALLOC_CAP_INTERNAL);
+		coded = (uint8_t*) heap_caps_malloc(encoder.maxOutput(BlockSamples), MALLOC_CAP_INTERNAL);
+		if(!pool || !spare || !coded){
+			ESP_LOGE(TAG, "error allocating %zu blocks of %zu samples", PoolBlocks, BlockSamples);
+			return false;
+		}
+
+		for(size_t i = 0; i < PoolBlocks; i++){
+			Block block = { pool + i * BlockSamples, 0 };
+			freeBlocks.post(block);
+		}
+
+#ifdef CONFIG_RECORDER_CONTINUOUS
+		//continue the numbering of earlier recordings
+		struct stat st;
+		while(snprintf(path, sizeof(path), "/sd/rec%05" PRIu32 ".wav", index), stat(path, &st) == 0){
+			index++;
+		}
+#endif
+
+		lastReport = millis();
+		writeThread.start();
+		readThread.start();
+		return true;
+	}
+
+	void stop(){
+		readThread.stop();
+		writeThread.stop();
+	}
+
+	//Fixed length mode: the recording is complete and closed
+	bool done() const{
+		return finished;
+	}
+
+private:
+	struct Block {
+		int16_t* samples;
+		size_t count;
+	};
+
+	Mic& mic;
+	int16_t* pool = nullptr;
+	int16_t* spare = nullptr; //read into when the pool is exhausted, to keep draining I2S
+	Queue<Block> freeBlocks;
+	Queue<Block> fullBlocks;
+
+	SDWriter writer;
+	AudioEncoder encoder{ Codec };
+	uint8_t* coded = nullptr; //one block's worth of encoder output
+	char path[24] = "/sd/record.wav";
+	uint32_t index = 0;
+	uint64_t fileSamples = 0;
+	uint64_t fileBytes = 0; //coded data in the current file
+	std::atomic<bool> finished = false;
+
+	std::atomic<uint32_t> pending = 0; //blocks read but not written yet
+	std::atomic<uint32_t> maxPending = 0;
+	std::atomic<uint32_t> dropped = 0;
+	uint64_t written = 0; //[B]
+	uint64_t reportedWritten = 0;
+	uint64_t recorded = 0; //[samples]
+	uint64_t reportedRecorded = 0;
+	uint32_t slowestWrite = 0; //[us] since the last report
+	uint64_t encodeTime = 0; //[us] since the last report
+	uint64_t lastReport = 0; //[ms]
+
+	ThreadedClosure readThread;
+	ThreadedClosure writeThread;
+
+	void readBlock(){
+		Block block;
+		if(!freeBlocks.get(block, 0)){
+			//the writer is a whole pool behind: lose this block, but on purpose and counted
+			mic.read(spare, BlockSamples);
+			dropped++;
+			return;
+		}
+
+		block.count = mic.read(block.samples, BlockSamples);
+
+		const uint32_t now = ++pending;
+		uint32_t max = maxPending;
+		while(now > max && !maxPending.compare_exchange_weak(max, now)){}
+
+		fullBlocks.post(block);
+	}
+
+	void writeBlock(){
+		Block block;
+		if(fullBlocks.get(block, pdMS_TO_TICKS(1000))){
+			if(!finished){
+				write(block.samples, block.count);
+			}
+			pending--;
+			freeBlocks.post(block);
+		}
+
+		if(millis() - lastReport >= CONFIG_RECORDER_REPORT_S * 1000ULL){
+			report();
+		}
+	}
+
+	//Splits the samples across files at the rotation limits
+	void write(const int16_t* samples, size_t count){
+		while(count > 0){
+			if(!writer.isOpen() && !open()) return;
+
+			const uint64_t room = FileSamples - fileSamples;
+			const size_t n = std::min<uint64_t>(count, room);
+
+			const uint64_t start = micros();
+			const size_t size = encoder.encode(samples, n, coded);
+			encodeTime += micros() - start;
+			writeCoded(size);
+
+			fileSamples += n;
+			recorded += n;
+			samples += n;
+			count -= n;
+
+			//the size limit is checked after the fact, a file ends up at most a block over it
+			if(n == room || fileBytes >= FileBytes){
+				close();
+#ifndef CONFIG_RECORDER_CONTINUOUS
+				finished = true;
+				return;
+#endif
+			}
+		}
+	}
+
+	void writeCoded(size_t size){
+		const uint64_t start = micros();
+		writer.write(coded, size);
+		slowestWrite = std::max<uint32_t>(slowestWrite, micros() - start);
+
+		fileBytes += size;
+		written += size;
+	}
+
+	bool open(){
+#ifdef CONFIG_RECORDER_CONTINUOUS
+		snprintf(path, sizeof(path), "/sd/rec%05" PRIu32 ".wav", index++);
+#endif
+
+		//preallocated for the longest file (as PCM, coded data is smaller), truncated to the actual length on close
+		const uint64_t size = encoder.headerSize() + std::min(FileBytes, FileSamples * sizeof(int16_t));
+		if(!writer.open(path, std::min<uint64_t>(size, UINT32_MAX))) return false;
+
+		//sizes are patched once they are known
+		uint8_t header[64];
+		encoder.reset();
+		encoder.header(header, SampleRate, 0, 0);
+		writer.write(header, encoder.headerSize());
+		fileSamples = 0;
+		fileBytes = 0;
+
+		ESP_LOGI(TAG, "recording to %s", path);
+		return true;
+	}
+
+	void close(){
+		writeCoded(encoder.flush(coded));
+		writer.close();
+
+		FILE* file = fopen(path, "r+b");
+		if(!file){
+			ESP_LOGE(TAG, "error patching %s header", path);
+			return;
+		}
+		uint8_t header[64];
+		encoder.header(header, SampleRate, fileSamples, fileBytes);
+		fwrite(header, encoder.headerSize(), 1, file);
+		fclose(file);
+
+		ESP_LOGI(TAG, "closed %s, %.1f s", path, (float) fileSamples / SampleRate);
+	}
+
+	void report(){
+		const uint64_t now = millis();
+
+		const uint64_t samples = recorded - reportedRecorded, bytes = written - reportedWritten;
+
+		//coding time over the recorded audio's duration is the share of a core the encoder takes
+		ESP_LOGI(TAG, "%.1f kB/s written, slowest write %.1f ms, coding %.2f:1 at %.1f%% CPU, pool %" PRIu32 "/%zu used at most, %" PRIu32 " blocks dropped, %" PRIu32 " I2S overruns",
+				 (float) bytes / (now - lastReport), slowestWrite / 1000.0f, bytes ? (float) samples * sizeof(int16_t) / bytes : 0.0f,
+				 samples ? encodeTime * SampleRate / (samples * 10000.0f) : 0.0f, maxPending.load(), PoolBlocks, dropped.load(), mic.getOverruns());
+
+		reportedWritten = written;
+		reportedRecorded = recorded;
+		slowestWrite = 0;
+		encodeTime = 0;
+		maxPending = pending.load();
+		lastReport = now;
+	}
+};
+
+extern "C" void app_main(void){
+	if(!SD::init((gpio_num_t) SPI_MISO, (gpio_num_t) SPI_MOSI,
+				 (gpio_num_t) SPI_CLK, (gpio_num_t) SD_SPI_CS, "/sd")){
+		return;
+	}
+
+	static Mic mic(SampleRate, (gpio_num_t) PDM_CLK, (gpio_num_t) PDM_DATA);
+	static Recorder recorder(mic);
+	if(!recorder.start()) return;
+
+#ifndef CONFIG_RECORDER_CONTINUOUS
+	ESP_LOGI(TAG, "recording %d s", CONFIG_RECORDER_TIME_S);
+	while(!recorder.done()){
+		vTaskDelay(pdMS_TO_TICKS(100));
+	}
+
+	recorder.stop();
+	SD::deinit();
+	ESP_LOGI(TAG, "done, card unmounted");
+#endif
+}
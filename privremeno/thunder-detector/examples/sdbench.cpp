@@ -0,0 +1,133 @@
+/* SD card write benchmark
+ *
+ * Writes a few MB to the card in chunks of several sizes, once through stdio as storeShots and the
+ * recorder used to, once through SDWriter and once through SDWriter into a preallocated file. Each line
+ * gives the sustained throughput including close(), and percentiles of the time a single write call
+ * blocked, the worst case being what a recording task has to buffer through.
+ *
+ * Runs instead of the firmware (CONFIG_EXAMPLE_SD_BENCHMARK), on the bus selected by CONFIG_SD_BUS.
+ */
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <sdkconfig.h>
+#include "Periph/SD.h"
+#include "Periph/SDWriter.h"
+#include "Util/Timer.h"
+#include "Pins.hpp"
+#include <algorithm>
+#include <vector>
+#include <iterator>
+#include <cstdio>
+#include <unistd.h>
+
+static constexpr const char* Path = "/sd/bench.bin";
+static constexpr size_t TotalSize = 4 * 1024 * 1024; //per run
+static constexpr size_t Chunks[] = { 512, 4096, 16384, 65536 };
+static constexpr size_t WriterBuffer = 32 * 1024;
+
+#if defined(CONFIG_SD_BUS_SDMMC_4BIT)
+static constexpr const char* Bus = "SDMMC 4-bit";
+#elif defined(CONFIG_SD_BUS_SDMMC_1BIT)
+static constexpr const char* Bus = "SDMMC 1-bit";
+#else
+static constexpr const char* Bus = "SPI";
+#endif
+
+static std::vector<uint32_t> samples; //[us] per write call
+
+static void report(const char* method, size_t chunk, uint64_t total){
+	std::sort(samples.begin(), samples.end());
+	const auto percentile = [](size_t p){ return samples[std::min(samples.size() - 1, samples.size() * p / 100)]; };
+	const auto ms = [](uint32_t us){ return us / 1000.0f; };
+
+	printf("%-10s %6zu %8.2f %8.3f %8.3f %8.3f %8.3f\n", method, chunk, (float) TotalSize / total, //B/us = MB/s
+		   ms(percentile(50)), ms(percentile(90)), ms(percentile(99)), ms(samples.back()));
+
+	unlink(Path);
+	vTaskDelay(1);
+}
+
+static void benchmarkStdio(const uint8_t* data, size_t chunk){
+	samples.clear();
+	const uint64_t start = micros();
+
+	FILE* file = fopen(Path, "w");
+	if(!file){
+		printf("%-10s %6zu error opening %s\n", "stdio", chunk, Path);
+		return;
+	}
+
+	for(size_t written = 0; written < TotalSize; written += chunk){
+		const uint64_t t = micros();
+		fwrite(data, 1, chunk, file);
+		samples.push_back(micros() - t);
+	}
+	fclose(file);
+
+	report("stdio", chunk, micros() - start);
+}
+
+static void benchmarkWriter(const uint8_t* data, size_t chunk, bool preallocate){
+	const char* method = preallocate ? "prealloc" : "SDWriter";
+	samples.clear();
+	const uint64_t start = micros();
+
+	SDWriter writer(WriterBuffer);
+	if(!writer.open(Path, preallocate ? TotalSize : 0)){
+		printf("%-10s %6zu error opening %s\n", method, chunk, Path);
+		return;
+	}
+
+	for(size_t written = 0; written < TotalSize; written += chunk){
+		const uint64_t t = micros();
+		writer.write(data, chunk);
+		samples.push_back(micros() - t);
+	}
+	writer.close();
+
+	report(method, chunk, micros() - start);
+}
+
+static void benchmark(){
+	esp_log_level_set("*", ESP_LOG_WARN);
+
+	if(!SD::init((gpio_num_t) SPI_MISO, (gpio_num_t) SPI_MOSI,
+				 (gpio_num_t) SPI_CLK, (gpio_num_t) SD_SPI_CS, "/sd")){
+		return;
+	}
+
+	//source data lives in PSRAM, like camera frames and JPEGs
+	auto data = (uint8_t*) heap_caps_malloc(Chunks[std::size(Chunks) - 1], MALLOC_CAP_SPIRAM);
+	if(!data){
+		printf("out of memory\n");
+		return;
+	}
+	for(size_t i = 0; i < Chunks[std::size(Chunks) - 1]; i++){
+		data[i] = i * 31;
+	}
+
+	printf("%s at %d kHz, %zu KB per run, SDWriter buffer %zu KB\n", Bus, CONFIG_SD_FREQ_KHZ, TotalSize / 1024, WriterBuffer / 1024);
+	printf("%-10s %6s %8s %8s %8s %8s %8s\n", "method", "chunk", "MB/s", "p50 ms", "p90 ms", "p99 ms", "max ms");
+
+	samples.reserve(TotalSize / Chunks[0]);
+	for(const auto chunk : Chunks){
+		benchmarkStdio(data, chunk);
+		benchmarkWriter(data, chunk, false);
+		benchmarkWriter(data, chunk, true);
+	}
+
+	heap_caps_free(data);
+	SD::deinit();
+	printf("done\n");
+}
+
+static void benchmarkTask(void*){
+	benchmark();
+	vTaskDelete(nullptr);
+}
+
+extern "C" void app_main(void){
+	xTaskCreate(benchmarkTask, "SDBenchmark", 8 * 1024, nullptr, 5, nullptr);
+}
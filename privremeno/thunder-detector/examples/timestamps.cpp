@@ -0,0 +1,158 @@
+/* Camera frame timestamp check
+ *
+ * Grabs frames at the full frame rate and at half of it (Camera::setFrameDivider(2)) and checks the timestamps
+ * the driver sets at VSYNC, which VisualDetector and the events use instead of micros() around getFrame():
+ * they are on the micros() time base and before the frame was returned, strictly increasing, and spaced by whole
+ * frame periods (a skipped frame gives two), the period doubling with the divider. Prints the spacing and the
+ * age of frames when they are returned, then PASS or FAIL.
+ *
+ * Runs instead of the firmware (CONFIG_EXAMPLE_CAMERA_TIMESTAMPS). Keep the camera pointed at a lit scene, the
+ * sensor lowers the frame rate by itself in the dark.
+ */
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_log.h>
+#include "Periph/I2C.h"
+#include "Devices/Camera.h"
+#include "Util/Timer.h"
+#include "Pins.hpp"
+#include <algorithm>
+#include <vector>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+
+static constexpr size_t Frames = 100; //per run
+static constexpr size_t Settle = 5; //frames skipped after a rate switch, some were started before it
+static constexpr float Tolerance = 0.1f; //of a period, for the spacing and the period ratio
+static constexpr uint64_t MaxAge = 500000; //[us] from the stamp to getFrame() returning
+
+struct Run {
+	uint32_t period = UINT32_MAX; //[us] shortest spacing
+	uint32_t maxSpacing = 0; //[us]
+	uint32_t agePercentile50 = 0, maxAge = 0; //[us]
+	size_t skipped = 0; //frames missing between the stamps
+	size_t errors = 0;
+};
+
+static bool grab(Camera& camera, std::vector<uint64_t>& stamps, std::vector<uint32_t>& ages, Run& run){
+	camera_fb_t* frame = camera.getFrame();
+	const uint64_t returned = micros();
+	if(frame == nullptr){
+		printf("getFrame failed\n");
+		return false;
+	}
+
+	const uint64_t stamp = (uint64_t) frame->timestamp.tv_sec * 1000000 + frame->timestamp.tv_usec;
+	if(camera.frameTime(frame) != stamp || stamp > returned || returned - stamp > MaxAge){
+		printf("stamp %" PRIu64 " us not on the timer base, returned at %" PRIu64 " us\n", stamp, returned);
+		run.errors++;
+	}
+	camera.releaseFrame();
+
+	if(!stamps.empty() && stamp <= stamps.back()){
+		printf("stamp %" PRIu64 " us not after %" PRIu64 " us\n", stamp, stamps.back());
+		run.errors++;
+	}
+
+	stamps.push_back(stamp);
+	ages.push_back(returned - stamp);
+	return true;
+}
+
+static Run measure(Camera& camera){
+	Run run;
+	std::vector<uint64_t> stamps;
+	std::vector<uint32_t> ages;
+	stamps.reserve(Frames);
+	ages.reserve(Frames);
+
+	for(size_t i = 0; i < Frames; i++){
+		if(!grab(camera, stamps, ages, run)){
+			run.errors++;
+			return run;
+		}
+	}
+
+	for(size_t i = 1; i < stamps.size(); i++){
+		if(stamps[i] <= stamps[i - 1]) continue;
+		const uint32_t spacing = stamps[i] - stamps[i - 1];
+		run.period = std::min(run.period, spacing);
+		run.maxSpacing = std::max(run.maxSpacing, spacing);
+	}
+	if(run.period == UINT32_MAX) return run;
+
+	//every spacing a whole number of periods
+	for(size_t i = 1; i < stamps.size(); i++){
+		if(stamps[i] <= stamps[i - 1]) continue;
+		const float periods = (float) (stamps[i] - stamps[i - 1]) / run.period;
+		const float whole = std::max(1.0f, std::round(periods));
+		if(std::abs(periods - whole) > Tolerance){
+			printf("spacing %" PRIu64 " us is %.2f periods\n", stamps[i] - stamps[i - 1], periods);
+			run.errors++;
+		}
+		run.skipped += (size_t) whole - 1;
+	}
+
+	std::sort(ages.begin(), ages.end());
+	run.agePercentile50 = ages[ages.size() / 2];
+	run.maxAge = ages.back();
+	return run;
+}
+
+static void report(const char* name, const Run& run){
+	printf("%-8s %8" PRIu32 " %8" PRIu32 " %8zu %8" PRIu32 " %8" PRIu32 " %6zu\n", name, run.period, run.maxSpacing, run.skipped,
+		   run.agePercentile50, run.maxAge, run.errors);
+}
+
+static void check(){
+	esp_log_level_set("*", ESP_LOG_WARN);
+
+	I2C i2c(I2C_NUM_0, (gpio_num_t) I2C_CAM_SDA, (gpio_num_t) I2C_CAM_SCL);
+	Camera camera(i2c);
+	if(camera.init() != ESP_OK){
+		printf("Cam init error\n");
+		return;
+	}
+
+	printf("%zu frames per run, spacing within %.0f%% of whole periods\n", Frames, Tolerance * 100);
+	printf("%-8s %8s %8s %8s %8s %8s %6s\n", "divider", "period", "max us", "skipped", "age p50", "max age", "errors");
+
+	const Run full = measure(camera);
+	report("1", full);
+	size_t errors = full.errors;
+
+	if(camera.setFrameDivider(2)){
+		std::vector<uint64_t> stamps;
+		std::vector<uint32_t> ages;
+		Run settle;
+		for(size_t i = 0; i < Settle; i++){
+			if(!grab(camera, stamps, ages, settle)) break;
+		}
+
+		const Run half = measure(camera);
+		report("2", half);
+		errors += half.errors;
+
+		const float ratio = (float) half.period / full.period;
+		if(std::abs(ratio - 2) > 2 * Tolerance){
+			printf("period grew %.2fx with the divider, not 2x\n", ratio);
+			errors++;
+		}
+		camera.setFrameDivider(1);
+	}else{
+		printf("frame divider not supported, skipped\n");
+	}
+
+	camera.deinit();
+	printf("%s\n", errors == 0 ? "PASS" : "FAIL");
+}
+
+static void checkTask(void*){
+	check();
+	vTaskDelete(nullptr);
+}
+
+extern "C" void app_main(void){
+	xTaskCreate(checkTask, "Timestamps", 8 * 1024, nullptr, 5, nullptr);
+}
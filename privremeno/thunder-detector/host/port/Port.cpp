@@ -0,0 +1,296 @@
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+#include <esp_camera.h>
+#include "VirtualClock.h"
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <map>
+#include <string>
+#include <cstring>
+
+//Time
+
+using SteadyClock = std::chrono::steady_clock;
+static const SteadyClock::time_point startTime = SteadyClock::now();
+
+static thread_local bool virtualEnabled = false;
+static thread_local int64_t virtualTime = 0;
+
+void VirtualClock::enable(int64_t start){
+	virtualEnabled = true;
+	virtualTime = start;
+}
+
+void VirtualClock::disable(){
+	virtualEnabled = false;
+}
+
+bool VirtualClock::enabled(){
+	return virtualEnabled;
+}
+
+void VirtualClock::set(int64_t us){
+	virtualTime = us;
+}
+
+int64_t VirtualClock::get(){
+	return virtualTime;
+}
+
+int64_t esp_timer_get_time(){
+	if(virtualEnabled) return virtualTime;
+	return std::chrono::duration_cast<std::chrono::microseconds>(SteadyClock::now() - startTime).count();
+}
+
+static std::chrono::microseconds ticksToDuration(TickType_t ticks){
+	return std::chrono::microseconds((uint64_t) ticks * 1000000 / CONFIG_FREERTOS_HZ);
+}
+
+//Critical sections
+
+static std::recursive_mutex criticalLock;
+
+void hostEnterCritical(){
+	criticalLock.lock();
+}
+
+void hostExitCritical(){
+	criticalLock.unlock();
+}
+
+//Tasks
+
+struct HostTask {
+	std::string name;
+};
+
+static thread_local HostTask* currentTask = nullptr;
+
+static TaskHandle_t spawn(TaskFunction_t fn, const char* name, void* arg){
+	auto task = new HostTask{ name };
+	std::thread([task, fn, arg](){
+		currentTask = task;
+		fn(arg);
+		delete task;
+	}).detach();
+	return task;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t, void* arg, UBaseType_t, TaskHandle_t* handle){
+	auto task = spawn(fn, name, arg);
+	if(handle) *handle = task;
+	return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackSize, void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t){
+	return xTaskCreate(fn, name, stackSize, arg, priority, handle);
+}
+
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t fn, const char* name, uint32_t, void* arg, UBaseType_t, StackType_t*, StaticTask_t*, BaseType_t){
+	return spawn(fn, name, arg);
+}
+
+void vTaskDelete(TaskHandle_t){
+	//the thread ends when its function returns
+}
+
+void vTaskDelay(TickType_t ticks){
+	std::this_thread::sleep_for(ticksToDuration(ticks));
+}
+
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t period){
+	*previousWake += period;
+	const auto now = xTaskGetTickCount();
+	if((int32_t) (*previousWake - now) > 0){
+		vTaskDelay(*previousWake - now);
+	}
+}
+
+TickType_t xTaskGetTickCount(){
+	return (TickType_t) ((SteadyClock::now() - startTime) / ticksToDuration(1));
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(){
+	return currentTask;
+}
+
+//Queues and semaphores
+
+struct HostQueue {
+	std::mutex mut;
+	std::condition_variable changed;
+	size_t length;
+	size_t itemSize;
+	std::vector<uint8_t> storage;
+	size_t head = 0;
+	size_t count = 0;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize){
+	auto queue = new HostQueue;
+	queue->length = length;
+	queue->itemSize = itemSize;
+	queue->storage.resize(length * itemSize);
+	return queue;
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t itemSize, uint8_t*, StaticQueue_t*){
+	return xQueueCreate(length, itemSize);
+}
+
+void vQueueDelete(QueueHandle_t queue){
+	delete queue;
+}
+
+//Waits on 'queue' until 'ready' holds, for at most 'timeout' ticks
+template<typename Pred>
+static bool waitFor(HostQueue* queue, std::unique_lock<std::mutex>& lock, TickType_t timeout, Pred ready){
+	if(timeout == portMAX_DELAY){
+		queue->changed.wait(lock, ready);
+		return true;
+	}
+	return queue->changed.wait_for(lock, ticksToDuration(timeout), ready);
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t timeout){
+	std::unique_lock lock(queue->mut);
+	if(!waitFor(queue, lock, timeout, [queue](){ return queue->count < queue->length; })) return pdFALSE;
+
+	if(queue->itemSize){
+		memcpy(queue->storage.data() + ((queue->head + queue->count) % queue->length) * queue->itemSize, item, queue->itemSize);
+	}
+	queue->count++;
+
+	queue->changed.notify_all();
+	return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t timeout){
+	std::unique_lock lock(queue->mut);
+	if(!waitFor(queue, lock, timeout, [queue](){ return queue->count > 0; })) return pdFALSE;
+
+	if(queue->itemSize){
+		memcpy(item, queue->storage.data() + queue->head * queue->itemSize, queue->itemSize);
+	}
+	queue->head = (queue->head + 1) % queue->length;
+	queue->count--;
+
+	queue->changed.notify_all();
+	return pdTRUE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue){
+	std::lock_guard lock(queue->mut);
+	queue->head = 0;
+	queue->count = 0;
+	queue->changed.notify_all();
+	return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue){
+	std::lock_guard lock(queue->mut);
+	return queue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue){
+	std::lock_guard lock(queue->mut);
+	return queue->length - queue->count;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(){
+	return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(){
+	auto sem = xQueueCreate(1, 0);
+	xQueueSend(sem, nullptr, 0);
+	return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t*){
+	return xSemaphoreCreateBinary();
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t*){
+	return xSemaphoreCreateMutex();
+}
+
+//Logging
+
+static std::mutex logLock;
+static esp_log_level_t defaultLevel = ESP_LOG_INFO;
+static std::map<std::string, esp_log_level_t> tagLevels;
+
+void esp_log_level_set(const char* tag, esp_log_level_t level){
+	std::lock_guard lock(logLock);
+	if(strcmp(tag, "*") == 0){
+		defaultLevel = level;
+		tagLevels.clear();
+	}else{
+		tagLevels[tag] = level;
+	}
+}
+
+bool hostLogEnabled(const char* tag, esp_log_level_t level){
+	std::lock_guard lock(logLock);
+	auto it = tagLevels.find(tag);
+	return level <= (it == tagLevels.end() ? defaultLevel : it->second);
+}
+
+uint32_t esp_log_timestamp(){
+	return esp_timer_get_time() / 1000;
+}
+
+const char* esp_err_to_name(esp_err_t err){
+	switch(err){
+		case ESP_OK: return "ESP_OK";
+		case ESP_FAIL: return "ESP_FAIL";
+		case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+		case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+		case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+		case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+		case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+		case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+		case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+		default: return "UNKNOWN ERROR";
+	}
+}
+
+//Heap and camera
+
+void* heap_caps_malloc(size_t size, uint32_t){
+	return malloc(size);
+}
+
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t){
+	return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t){
+	return calloc(n, size);
+}
+
+void heap_caps_free(void* ptr){
+	free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t){
+	return SIZE_MAX;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t){
+	return SIZE_MAX;
+}
+
+bool fmt2jpg(uint8_t*, size_t, uint16_t, uint16_t, pixformat_t, uint8_t, uint8_t**, size_t*){
+	return false;
+}
+
@@ -0,0 +1,21 @@
+#ifndef THUNDER_DETECTOR_HOST_VIRTUALCLOCK_H
+#define THUNDER_DETECTOR_HOST_VIRTUALCLOCK_H
+
+#include <cstdint>
+
+/**
+ * Per-thread replacement of esp_timer time for replay. While enabled on a thread, esp_timer_get_time(),
+ * and with it millis()/micros(), return the time last set on that thread, so independent replays can run
+ * in parallel threads, each on its own timeline.
+ */
+class VirtualClock {
+public:
+	static void enable(int64_t start = 0);
+	static void disable();
+	static bool enabled();
+
+	static void set(int64_t us);
+	static int64_t get();
+};
+
+#endif //THUNDER_DETECTOR_HOST_VIRTUALCLOCK_H
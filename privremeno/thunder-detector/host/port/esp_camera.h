@@ -0,0 +1,35 @@
+#ifndef THUNDER_DETECTOR_HOST_ESP_CAMERA_H
+#define THUNDER_DETECTOR_HOST_ESP_CAMERA_H
+
+//Frame types of the esp32-camera component, enough for FrameSource and the detectors on host
+
+#include <cstddef>
+#include <cstdint>
+#include <sys/time.h>
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+
+typedef enum {
+	PIXFORMAT_RGB565, PIXFORMAT_YUV422, PIXFORMAT_YUV420, PIXFORMAT_GRAYSCALE, PIXFORMAT_JPEG,
+	PIXFORMAT_RGB888, PIXFORMAT_RAW, PIXFORMAT_RGB444, PIXFORMAT_RGB555
+} pixformat_t;
+
+typedef enum {
+	FRAMESIZE_96X96, FRAMESIZE_QQVGA, FRAMESIZE_QCIF, FRAMESIZE_HQVGA, FRAMESIZE_240X240, FRAMESIZE_QVGA,
+	FRAMESIZE_CIF, FRAMESIZE_HVGA, FRAMESIZE_VGA, FRAMESIZE_SVGA, FRAMESIZE_XGA, FRAMESIZE_HD, FRAMESIZE_SXGA,
+	FRAMESIZE_UXGA, FRAMESIZE_INVALID
+} framesize_t;
+
+typedef struct {
+	uint8_t* buf;
+	size_t len;
+	size_t width;
+	size_t height;
+	pixformat_t format;
+	struct timeval timestamp;
+} camera_fb_t;
+
+//No JPEG encoder on host, always fails
+bool fmt2jpg(uint8_t* src, size_t src_len, uint16_t width, uint16_t height, pixformat_t format, uint8_t quality, uint8_t** out, size_t* out_len);
+
+#endif //THUNDER_DETECTOR_HOST_ESP_CAMERA_H
@@ -0,0 +1,26 @@
+#ifndef THUNDER_DETECTOR_HOST_ESP_LOG_H
+#define THUNDER_DETECTOR_HOST_ESP_LOG_H
+
+#include <cstdio>
+#include <cstdint>
+#include "esp_err.h"
+
+typedef enum {
+	ESP_LOG_NONE, ESP_LOG_ERROR, ESP_LOG_WARN, ESP_LOG_INFO, ESP_LOG_DEBUG, ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+void esp_log_level_set(const char* tag, esp_log_level_t level);
+bool hostLogEnabled(const char* tag, esp_log_level_t level);
+uint32_t esp_log_timestamp();
+
+#define HOST_LOG(level, letter, tag, format, ...) do{ \
+        if(hostLogEnabled(tag, level)) printf(letter " (%u) %s: " format "\n", esp_log_timestamp(), tag, ##__VA_ARGS__); \
+    }while(0)
+
+#define ESP_LOGE(tag, format, ...) HOST_LOG(ESP_LOG_ERROR, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) HOST_LOG(ESP_LOG_WARN, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) HOST_LOG(ESP_LOG_INFO, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) HOST_LOG(ESP_LOG_DEBUG, "D", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) HOST_LOG(ESP_LOG_VERBOSE, "V", tag, format, ##__VA_ARGS__)
+
+#endif //THUNDER_DETECTOR_HOST_ESP_LOG_H
@@ -0,0 +1,9 @@
+#ifndef THUNDER_DETECTOR_HOST_ESP_TIMER_H
+#define THUNDER_DETECTOR_HOST_ESP_TIMER_H
+
+#include <cstdint>
+
+//Microseconds since start, or the calling thread's VirtualClock when it is enabled
+int64_t esp_timer_get_time();
+
+#endif //THUNDER_DETECTOR_HOST_ESP_TIMER_H
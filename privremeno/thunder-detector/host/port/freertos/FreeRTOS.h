@@ -0,0 +1,63 @@
+#ifndef THUNDER_DETECTOR_HOST_FREERTOS_H
+#define THUNDER_DETECTOR_HOST_FREERTOS_H
+
+//Subset of the FreeRTOS API used by the firmware, implemented on std::thread in host/port/Port.cpp.
+//Tasks are plain threads with no priorities or core affinity; ticks are real time.
+
+#include <cstddef>
+#include <cstdint>
+#include <sdkconfig.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint8_t StackType_t;
+
+#define portMAX_DELAY ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS (1000 / CONFIG_FREERTOS_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t) ((uint64_t) (ms) * CONFIG_FREERTOS_HZ / 1000))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define portNUM_PROCESSORS 1
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+//Critical sections and interrupt masking map to one process-wide recursive lock
+struct portMUX_TYPE {
+	int unused;
+};
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+
+void hostEnterCritical();
+void hostExitCritical();
+
+#define taskENTER_CRITICAL(mux) hostEnterCritical()
+#define taskEXIT_CRITICAL(mux) hostExitCritical()
+#define portENTER_CRITICAL(mux) hostEnterCritical()
+#define portEXIT_CRITICAL(mux) hostExitCritical()
+#define portSET_INTERRUPT_MASK_FROM_ISR() (hostEnterCritical(), 0)
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x) ((void) (x), hostExitCritical())
+
+inline BaseType_t xPortGetCoreID(){ return 0; }
+
+typedef struct HostTask* TaskHandle_t;
+typedef struct HostQueue* QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+
+typedef struct {
+	void* unused[8];
+} StaticTask_t;
+
+typedef struct {
+	void* unused[8];
+} StaticQueue_t;
+
+typedef StaticQueue_t StaticSemaphore_t;
+
+typedef void (* TaskFunction_t)(void*);
+
+#endif //THUNDER_DETECTOR_HOST_FREERTOS_H
@@ -0,0 +1,16 @@
+#ifndef THUNDER_DETECTOR_HOST_SEMPHR_H
+#define THUNDER_DETECTOR_HOST_SEMPHR_H
+
+#include "queue.h"
+
+//Semaphores are queues of zero-sized items, as in FreeRTOS
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t* buffer);
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer);
+
+#define vSemaphoreDelete(sem) vQueueDelete(sem)
+#define xSemaphoreTake(sem, timeout) xQueueReceive(sem, nullptr, timeout)
+#define xSemaphoreGive(sem) xQueueSend(sem, nullptr, 0)
+
+#endif //THUNDER_DETECTOR_HOST_SEMPHR_H
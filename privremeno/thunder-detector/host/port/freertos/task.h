@@ -0,0 +1,18 @@
+#ifndef THUNDER_DETECTOR_HOST_TASK_H
+#define THUNDER_DETECTOR_HOST_TASK_H
+
+#include "FreeRTOS.h"
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stackSize, void* arg, UBaseType_t priority, TaskHandle_t* handle);
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackSize, void* arg, UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+TaskHandle_t xTaskCreateStaticPinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackSize, void* arg, UBaseType_t priority, StackType_t* stack, StaticTask_t* tcb, BaseType_t core);
+
+//Deleting the calling task returns, the task function is expected to return right after (as Threaded does)
+void vTaskDelete(TaskHandle_t task);
+
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t* previousWake, TickType_t period);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+
+#endif //THUNDER_DETECTOR_HOST_TASK_H
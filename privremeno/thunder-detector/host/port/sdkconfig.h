@@ -0,0 +1,14 @@
+#ifndef THUNDER_DETECTOR_HOST_SDKCONFIG_H
+#define THUNDER_DETECTOR_HOST_SDKCONFIG_H
+
+//Host build configuration. Device-only features (static allocation, instrumentation, trace and
+//deferred log outputs) stay disabled, the rest mirrors the firmware defaults.
+
+#define CONFIG_FREERTOS_HZ 100
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ 240
+
+//every replay thread has its own detectors, the budgets only matter on the device
+#define CONFIG_MEMORY_HOT_KB (1024 * 1024)
+#define CONFIG_MEMORY_DMA_KB (1024 * 1024)
+
+#endif //THUNDER_DETECTOR_HOST_SDKCONFIG_H
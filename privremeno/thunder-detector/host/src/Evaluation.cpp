@@ -0,0 +1,162 @@
+#include "Evaluation.h"
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cinttypes>
+
+bool GroundTruth::load(const char* path){
+	FILE* file = fopen(path, "r");
+	if(file == nullptr){
+		fprintf(stderr, "Can't open %s\n", path);
+		return false;
+	}
+
+	char line[128];
+	size_t lineNum = 0;
+	bool ok = true;
+
+	while(fgets(line, sizeof(line), file)){
+		lineNum++;
+		if(line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+
+		uint64_t a = 0, b = 0;
+		if(sscanf(line, "flash,%" SCNu64, &a) == 1){
+			flashes.push_back(a * 1000);
+		}else if(sscanf(line, "thunder,%" SCNu64, &a) == 1){
+			thunders.push_back(a * 1000);
+		}else if(sscanf(line, "strike,%" SCNu64 ",%" SCNu64, &a, &b) == 2){
+			strikes.push_back({ a * 1000, b * 1000, 0 });
+		}else{
+			fprintf(stderr, "%s:%zu: malformed annotation\n", path, lineNum);
+			ok = false;
+			break;
+		}
+	}
+
+	fclose(file);
+
+	std::sort(flashes.begin(), flashes.end());
+	std::sort(thunders.begin(), thunders.end());
+	std::sort(strikes.begin(), strikes.end(), [](const auto& a, const auto& b){ return a.videoTimestamp < b.videoTimestamp; });
+
+	return ok;
+}
+
+void Score::add(const Score& other){
+	truePositives += other.truePositives;
+	falsePositives += other.falsePositives;
+	falseNegatives += other.falseNegatives;
+	latencies.insert(latencies.end(), other.latencies.begin(), other.latencies.end());
+}
+
+//Both are 1 when there was nothing to get wrong, so sessions without a kind of event don't skew a sweep
+float Score::precision() const{
+	const auto detected = truePositives + falsePositives;
+	return detected == 0 ? 1.0f : (float) truePositives / detected;
+}
+
+float Score::recall() const{
+	const auto annotated = truePositives + falseNegatives;
+	return annotated == 0 ? 1.0f : (float) truePositives / annotated;
+}
+
+int64_t Score::latency(float percentile) const{
+	if(latencies.empty()) return 0;
+
+	auto sorted = latencies;
+	std::sort(sorted.begin(), sorted.end());
+	const size_t index = std::min(sorted.size() - 1, (size_t) (percentile / 100.0f * sorted.size()));
+	return sorted[index];
+}
+
+/**
+ * Greedy matching of time-sorted detections to time-sorted annotations.
+ * @param timeOf timestamp [us] used for the latency
+ * @param matches whether a detection may be matched to an annotation
+ */
+template<typename D, typename A, typename T, typename M>
+static Score match(const std::vector<D>& detections, const std::vector<A>& annotations, T timeOf, M matches){
+	Score score;
+	std::vector<bool> used(annotations.size(), false);
+	size_t first = 0; //annotations before this one are all used
+
+	for(const auto& detection : detections){
+		bool found = false;
+
+		for(size_t i = first; i < annotations.size(); i++){
+			if(used[i] || !matches(detection, annotations[i])) continue;
+
+			used[i] = true;
+			found = true;
+			score.truePositives++;
+			score.latencies.push_back(((int64_t) timeOf(detection) - (int64_t) timeOf(annotations[i])) / 1000);
+			break;
+		}
+
+		if(!found){
+			score.falsePositives++;
+		}
+
+		while(first < used.size() && used[first]){
+			first++;
+		}
+	}
+
+	score.falseNegatives = std::count(used.begin(), used.end(), false);
+	return score;
+}
+
+static bool within(uint64_t a, uint64_t b, uint64_t tolerance){
+	return (a > b ? a - b : b - a) <= tolerance;
+}
+
+Evaluation Evaluation::evaluate(const Replay::Result& result, const GroundTruth& truth, size_t toleranceMs){
+	const uint64_t tolerance = (uint64_t) toleranceMs * 1000;
+	std::vector<uint64_t> video, audio;
+	for(const auto& event : result.events){
+		if(event.type == SensorEvent::Type::Video){
+			video.push_back(event.timestamp);
+		}else{
+			audio.push_back(event.timestamp);
+		}
+	}
+	std::sort(video.begin(), video.end());
+	std::sort(audio.begin(), audio.end());
+
+	auto strikes = result.strikes;
+	std::sort(strikes.begin(), strikes.end(), [](const auto& a, const auto& b){ return a.videoTimestamp < b.videoTimestamp; });
+
+	const auto time = [](uint64_t t){ return t; };
+	const auto near = [tolerance](uint64_t detection, uint64_t annotation){ return within(detection, annotation, tolerance); };
+
+	Evaluation evaluation;
+	evaluation.video = match(video, truth.flashes, time, near);
+	evaluation.audio = match(audio, truth.thunders, time, near);
+	evaluation.strike = match(strikes, truth.strikes,
+							  [](const Fusion::Strike& s){ return s.videoTimestamp; },
+							  [tolerance](const Fusion::Strike& detection, const Fusion::Strike& annotation){
+								  return within(detection.videoTimestamp, annotation.videoTimestamp, tolerance) &&
+										 within(detection.audioTimestamp, annotation.audioTimestamp, tolerance);
+							  });
+	return evaluation;
+}
+
+void Evaluation::add(const Evaluation& other){
+	video.add(other.video);
+	audio.add(other.audio);
+	strike.add(other.strike);
+}
+
+void Evaluation::writeHeader(FILE* out){
+	for(const char* kind : { "video", "audio", "strike" }){
+		fprintf(out, "%s_precision,%s_recall,%s_p50_ms,%s_p90_ms", kind, kind, kind, kind);
+		fputc(strcmp(kind, "strike") == 0 ? '\n' : ',', out);
+	}
+}
+
+void Evaluation::write(FILE* out) const{
+	for(const Score* score : { &video, &audio, &strike }){
+		fprintf(out, "%.3f,%.3f,%" PRId64 ",%" PRId64, score->precision(), score->recall(), score->latency(50), score->latency(90));
+		fputc(score == &strike ? '\n' : ',', out);
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef THUNDER_DETECTOR_HOST_EVALUATION_H
+#define THUNDER_DETECTOR_HOST_EVALUATION_H
+
+#include "Replay.h"
+#include <vector>
+#include <cstdio>
+
+/**
+ * Ground-truth annotations of a recorded session, timestamps in [us] from the start of the recording like the
+ * events. Text file in [ms], one annotation per line, same shape as Replay::write():
+ * "flash,<ms>", "thunder,<ms>[,<type>]", "strike,<flash ms>,<thunder ms>". Lines starting with '#' are skipped.
+ */
+struct GroundTruth {
+	std::vector<uint64_t> flashes;
+	std::vector<uint64_t> thunders;
+	std::vector<Fusion::Strike> strikes; //distance is not compared
+
+	//false if the file couldn't be opened or has a malformed line
+	bool load(const char* path);
+};
+
+/**
+ * Detection quality of one event kind, summed over any number of sessions.
+ */
+struct Score {
+	size_t truePositives = 0;
+	size_t falsePositives = 0;
+	size_t falseNegatives = 0;
+	std::vector<int64_t> latencies; //[ms] detection - annotation, of true positives
+
+	void add(const Score& other);
+
+	float precision() const;
+	float recall() const;
+
+	/**
+	 * @param percentile 0 - 100
+	 * @return [ms] latency at the percentile, 0 if there were no true positives
+	 */
+	int64_t latency(float percentile) const;
+};
+
+struct Evaluation {
+	Score video, audio, strike;
+
+	/**
+	 * Matches detections to annotations in time order. A detection matches the earliest unmatched
+	 * annotation that is at most 'toleranceMs' away, every detection and annotation is used at most once.
+	 */
+	static Evaluation evaluate(const Replay::Result& result, const GroundTruth& truth, size_t toleranceMs);
+
+	void add(const Evaluation& other);
+
+	//CSV columns: <kind>_precision,<kind>_recall,<kind>_p50_ms,<kind>_p90_ms for video, audio and strike
+	static void writeHeader(FILE* out);
+	void write(FILE* out) const;
+};
+
+#endif //THUNDER_DETECTOR_HOST_EVALUATION_H
@@ -0,0 +1,145 @@
+#include "EventLogReader.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+static bool before(const EventIndexEntry& a, const EventIndexEntry& b){
+	return a.boot != b.boot ? a.boot < b.boot : a.timestamp < b.timestamp;
+}
+
+EventLogReader::EventLogReader(const char* path){
+	file = fopen(path, "rb");
+	if(!file) return;
+
+	EventLogHeader header;
+	if(fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, EventLogHeaderDefault.magic, 4) != 0 ||
+	   header.version != EventLogHeaderDefault.version || header.recordSize != sizeof(EventRecord)){
+		fprintf(stderr, "%s: not an event log\n", path);
+		fclose(file);
+		file = nullptr;
+		return;
+	}
+
+	fseek(file, 0, SEEK_END);
+	count = (ftell(file) - sizeof(header)) / sizeof(EventRecord);
+
+	std::string indexPath = path;
+	const auto dot = indexPath.rfind('.');
+	indexPath = (dot == std::string::npos ? indexPath : indexPath.substr(0, dot)) + ".idx";
+
+	if(!loadIndex(indexPath.c_str()) || (!index.empty() && (!indexValid(index.front()) || !indexValid(index.back())))){
+		rebuildIndex();
+	}
+}
+
+EventLogReader::~EventLogReader(){
+	if(file) fclose(file);
+}
+
+bool EventLogReader::isOpen() const{
+	return file != nullptr;
+}
+
+size_t EventLogReader::getCount() const{
+	return count;
+}
+
+const std::vector<EventIndexEntry>& EventLogReader::getIndex() const{
+	return index;
+}
+
+size_t EventLogReader::getSkipped() const{
+	return skipped;
+}
+
+bool EventLogReader::read(size_t n, EventRecord& record){
+	if(n >= count) return false;
+
+	fseek(file, sizeof(EventLogHeader) + n * sizeof(EventRecord), SEEK_SET);
+	return fread(&record, sizeof(record), 1, file) == 1 && record.crc == eventRecordCrc(record);
+}
+
+bool EventLogReader::next(EventRecord& record){
+	while(position < count){
+		if(read(position++, record)) return true;
+		skipped++;
+	}
+	return false;
+}
+
+bool EventLogReader::loadIndex(const char* path){
+	FILE* indexFile = fopen(path, "rb");
+	if(!indexFile) return false;
+
+	EventLogHeader header;
+	bool ok = fread(&header, sizeof(header), 1, indexFile) == 1 && memcmp(header.magic, EventIndexHeaderDefault.magic, 4) == 0 &&
+			  header.version == EventIndexHeaderDefault.version && header.recordSize == sizeof(EventIndexEntry);
+
+	EventIndexEntry entry;
+	while(ok && fread(&entry, sizeof(entry), 1, indexFile) == 1){
+		index.push_back(entry);
+	}
+	fclose(indexFile);
+
+	//a torn log tail gets overwritten after reboot, so the index may point past or into replaced records
+	ok = ok && std::is_sorted(index.begin(), index.end(), before);
+	if(!ok) index.clear();
+	return ok;
+}
+
+bool EventLogReader::indexValid(const EventIndexEntry& entry){
+	EventRecord record;
+	return read(entry.sequence, record) && record.type == EventRecordType::Sync &&
+		   record.boot == entry.boot && record.timestamp == entry.timestamp;
+}
+
+void EventLogReader::rebuildIndex(){
+	index.clear();
+
+	EventRecord record;
+	for(size_t n = 0; n < count; n++){
+		if(read(n, record) && record.type == EventRecordType::Sync){
+			index.push_back({ record.timestamp, record.boot, (uint32_t) n });
+		}
+	}
+}
+
+bool EventLogReader::seek(uint32_t boot, uint64_t timestamp){
+	const EventIndexEntry key = { timestamp, boot, 0 };
+
+	//last sync point not after the key
+	auto it = std::upper_bound(index.begin(), index.end(), key, before);
+	if(it != index.begin()){
+		--it;
+		if(!indexValid(*it)){
+			rebuildIndex();
+			it = std::upper_bound(index.begin(), index.end(), key, before);
+			if(it != index.begin()) --it;
+		}
+	}
+	position = it != index.end() && !before(key, *it) ? it->sequence : 0;
+
+	EventRecord record;
+	while(next(record)){
+		if(record.boot > boot || (record.boot == boot && record.timestamp >= timestamp)){
+			position--; //next() returns this record again
+			return true;
+		}
+	}
+	return false;
+}
+
+bool EventLogReader::toEvent(const EventRecord& record, SensorEvent& event){
+	if(record.type == EventRecordType::Video){
+		//only the intensity is logged, the shape of the change is left empty
+		VideoEvent video{};
+		video.intensity = record.value;
+		event = { SensorEvent::Type::Video, record.timestamp * 1000, { .video = video }};
+		return true;
+	}
+	if(record.type == EventRecordType::Audio){
+		event = { SensorEvent::Type::Audio, record.timestamp * 1000, { .audio = { (ThunderType) record.value }}};
+		return true;
+	}
+	return false;
+}
@@ -0,0 +1,58 @@
+#ifndef THUNDER_DETECTOR_HOST_EVENTLOGREADER_H
+#define THUNDER_DETECTOR_HOST_EVENTLOGREADER_H
+
+#include <EventLogFormat.h>
+#include <SensorEvent.hpp>
+#include <vector>
+#include <cstdio>
+
+/**
+ * Reads the binary event log written by EventLog (events.bin with its events.idx sidecar).
+ * Records are in arrival order, so timestamps within a boot are only roughly sorted - but no event is
+ * logged before a Sync record with a later timestamp, which is what seek() relies on.
+ */
+class EventLogReader {
+public:
+	/**
+	 * @param path of events.bin, the index is looked for next to it with the .idx extension and rebuilt
+	 * from the Sync records when it's missing or doesn't match the log
+	 */
+	EventLogReader(const char* path);
+	~EventLogReader();
+
+	bool isOpen() const;
+
+	//Records in the log, including torn ones
+	size_t getCount() const;
+
+	const std::vector<EventIndexEntry>& getIndex() const;
+
+	/**
+	 * Positions the reader before the first record of 'boot' with a timestamp at or after 'timestamp'.
+	 * A binary search over the index finds the last sync point before it, the rest is a short scan.
+	 * @return false if there is no such record
+	 */
+	bool seek(uint32_t boot, uint64_t timestamp);
+
+	//Next intact record, torn ones (bad CRC) are skipped and counted
+	bool next(EventRecord& record);
+
+	size_t getSkipped() const;
+
+	//@return false for records that aren't detections (Sync, Strike)
+	static bool toEvent(const EventRecord& record, SensorEvent& event);
+
+private:
+	FILE* file = nullptr;
+	size_t count = 0;
+	size_t position = 0; //record next() reads
+	size_t skipped = 0;
+	std::vector<EventIndexEntry> index;
+
+	bool read(size_t n, EventRecord& record);
+	bool loadIndex(const char* path);
+	void rebuildIndex();
+	bool indexValid(const EventIndexEntry& entry);
+};
+
+#endif //THUNDER_DETECTOR_HOST_EVENTLOGREADER_H
@@ -0,0 +1,74 @@
+#include "FrameFileSource.h"
+#include <cstring>
+
+FrameFileSource::FrameFileSource(const char* path){
+	file = fopen(path, "rb");
+	if(!file) return;
+
+	if(fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, FrameFileMagic, 4) != 0 || header.version != FrameFileVersion){
+		fprintf(stderr, "%s: not a frame file\n", path);
+		fclose(file);
+		file = nullptr;
+		return;
+	}
+
+	if(header.format == FrameFileCoded){
+		decoder.emplace(header.width, header.height);
+	}
+
+	readEntry();
+}
+
+FrameFileSource::~FrameFileSource(){
+	if(file) fclose(file);
+}
+
+bool FrameFileSource::isOpen() const{
+	return file != nullptr;
+}
+
+void FrameFileSource::readEntry(){
+	hasNext = fread(&next, sizeof(next), 1, file) == 1;
+}
+
+camera_fb_t* FrameFileSource::getFrame(){
+	if(!hasNext) return nullptr;
+
+	data.resize(next.len);
+	if(fread(data.data(), 1, next.len, file) != next.len){
+		hasNext = false;
+		return nullptr;
+	}
+
+	frame.buf = data.data();
+	frame.len = next.len;
+	frame.width = header.width;
+	frame.height = header.height;
+	frame.format = (pixformat_t) header.format;
+
+	if(decoder){
+		const uint8_t* pixels = decoder->decode(data.data(), data.size());
+		if(!pixels){
+			fprintf(stderr, "corrupt frame at %.3f s\n", next.timestamp / 1000000.0);
+			hasNext = false;
+			return nullptr;
+		}
+
+		decoded.assign(pixels, pixels + header.width * header.height);
+		frame.buf = decoded.data();
+		frame.len = decoded.size();
+		frame.format = PIXFORMAT_GRAYSCALE;
+	}
+	frame.timestamp.tv_sec = next.timestamp / 1000000;
+	frame.timestamp.tv_usec = next.timestamp % 1000000;
+
+	readEntry();
+	return &frame;
+}
+
+void FrameFileSource::releaseFrame(){ }
+
+bool FrameFileSource::peek(uint64_t& timestamp){
+	timestamp = next.timestamp;
+	return hasNext;
+}
@@ -0,0 +1,41 @@
+#ifndef THUNDER_DETECTOR_HOST_FRAMEFILESOURCE_H
+#define THUNDER_DETECTOR_HOST_FRAMEFILESOURCE_H
+
+#include "ReplaySource.h"
+#include <FrameFileFormat.h>
+#include <Util/FrameCodec.h>
+#include <cstdio>
+#include <vector>
+#include <optional>
+
+/**
+ * Reads frames from a FrameFile. Coded frames (FrameFileCoded) are decoded into 8-bit grayscale.
+ */
+class FrameFileSource : public ReplayFrames {
+public:
+	FrameFileSource(const char* path);
+	~FrameFileSource() override;
+
+	bool isOpen() const;
+
+	camera_fb_t* getFrame() override;
+	void releaseFrame() override;
+	bool peek(uint64_t& timestamp) override;
+
+private:
+	FILE* file = nullptr;
+	FrameFileHeader header{};
+
+	FrameFileEntry next{};
+	bool hasNext = false;
+
+	std::vector<uint8_t> data;
+	camera_fb_t frame{};
+
+	std::optional<FrameDecoder> decoder;
+	std::vector<uint8_t> decoded;
+
+	void readEntry();
+};
+
+#endif //THUNDER_DETECTOR_HOST_FRAMEFILESOURCE_H
@@ -0,0 +1,112 @@
+#include "Replay.h"
+#include "VirtualClock.h"
+#include <Util/Queue.h>
+#include <optional>
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+
+Replay::Replay(ReplayAudio* audio, ReplayFrames* frames, size_t audioBuffer) : audio(audio), frames(frames), audioBuffer(audioBuffer){
+	//the audio position would never advance
+	if(audioBuffer == 0){
+		fprintf(stderr, "Replay with an audio buffer of 0 samples\n");
+		abort();
+	}
+}
+
+void Replay::setParams(const Params& params){
+	this->params = params;
+}
+
+Replay::Result Replay::run(){
+	Result result;
+	VirtualClock::enable(0);
+
+	//a step posts at most a handful of events and the queue is drained after every step
+	Queue<SensorEvent> queue(64, "Replay");
+
+	std::optional<AudioDetector> audioDetector;
+	if(audio){
+		audioDetector.emplace(audio, audioBuffer, &queue);
+		audioDetector->setParams(params.audio);
+	}
+
+	std::optional<VisualDetector> videoDetector;
+	if(frames){
+		videoDetector.emplace(frames, &queue);
+		videoDetector->setStoreShots(false);
+		videoDetector->setParams(params.video);
+	}
+
+	Fusion fusion;
+	uint64_t audioPos = 0; //[samples]
+
+	for(;;){
+		const bool haveAudio = audio && !audio->finished();
+		uint64_t frameTime = 0;
+		const bool haveVideo = frames && frames->peek(frameTime);
+		if(!haveAudio && !haveVideo) break;
+
+		//on the device an audio block is processed when it has been fully captured, a frame right away
+		const uint64_t audioStart = haveAudio ? audioPos * 1000000 / audio->getSampleRate() : 0;
+		const uint64_t audioEnd = haveAudio ? (audioPos + audioBuffer) * 1000000 / audio->getSampleRate() : 0;
+
+		if(haveAudio && (!haveVideo || audioEnd <= frameTime)){
+			VirtualClock::set(audioStart);
+			audioDetector->step();
+			audioPos += audioBuffer;
+			result.duration = std::max(result.duration, audioEnd);
+		}else{
+			VirtualClock::set(frameTime);
+			videoDetector->step();
+			result.duration = std::max(result.duration, frameTime);
+		}
+
+		SensorEvent event{};
+		while(queue.get(event, 0)){
+			fuse(event, fusion, result);
+		}
+	}
+
+	VirtualClock::disable();
+	return result;
+}
+
+Replay::Result Replay::fuse(const std::vector<SensorEvent>& events){
+	Result result;
+	Fusion fusion;
+
+	for(const auto& event : events){
+		fuse(event, fusion, result);
+		result.duration = std::max<uint64_t>(result.duration, event.timestamp);
+	}
+
+	return result;
+}
+
+void Replay::fuse(const SensorEvent& event, Fusion& fusion, Result& result){
+	result.events.push_back(event);
+
+	Fusion::Strike strike;
+	if(fusion.process(event, strike)){
+		result.strikes.push_back(strike);
+	}
+}
+
+void Replay::write(FILE* out, const Result& result){
+	static constexpr const char* ThunderNames[] = { "clap", "peal", "rumble" };
+
+	for(const auto& event : result.events){
+		if(event.type == SensorEvent::Type::Video){
+			const auto& video = event.video;
+			fprintf(out, "video,%" PRIu64 ",%u,%u,%u,%u,%u,%u,%u,%.2f\n", event.timestamp / 1000, video.intensity, video.regions, video.coverage,
+					video.left, video.top, video.right, video.bottom, video.elongation);
+		}else{
+			fprintf(out, "audio,%" PRIu64 ",%s\n", event.timestamp / 1000, ThunderNames[(int) event.audio.type]);
+		}
+	}
+
+	for(const auto& strike : result.strikes){
+		fprintf(out, "strike,%" PRIu64 ",%" PRIu64 ",%.2f\n", strike.videoTimestamp / 1000, strike.audioTimestamp / 1000, strike.distance);
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef THUNDER_DETECTOR_HOST_REPLAY_H
+#define THUNDER_DETECTOR_HOST_REPLAY_H
+
+#include "ReplaySource.h"
+#include <SensorEvent.hpp>
+#include <Fusion.h>
+#include <AudioDetector.h>
+#include <VisualDetector.h>
+#include <vector>
+#include <cstdio>
+
+/**
+ * Feeds recorded audio and frames through the firmware detectors and fusion on a virtual clock.
+ * The detectors don't get threads - their loops are stepped on the calling thread in timeline order,
+ * so the result is deterministic and the replay runs as fast as the CPU allows. Independent Replays
+ * may run in parallel on different threads.
+ */
+class Replay {
+public:
+	/**
+	 * @param audio optional
+	 * @param frames optional
+	 * @param audioBuffer AudioDetector buffer size [samples], aborts if 0
+	 */
+	Replay(ReplayAudio* audio, ReplayFrames* frames, size_t audioBuffer = 16000);
+
+	//Detector thresholds used by run(), firmware defaults unless set
+	struct Params {
+		AudioDetector::Params audio;
+		VisualDetector::Params video;
+	};
+
+	void setParams(const Params& params);
+
+	struct Result {
+		std::vector<SensorEvent> events;
+		std::vector<Fusion::Strike> strikes;
+		uint64_t duration = 0; //[us] of replayed input
+	};
+
+	Result run();
+
+	//Runs already detected events, e.g. from an EventLogReader, through a fresh Fusion
+	static Result fuse(const std::vector<SensorEvent>& events);
+
+	//One line per event and strike: "video,<ms>,<intensity>,<regions>,<coverage>,<left>,<top>,<right>,<bottom>,<elongation>",
+	//"audio,<ms>,<type>", "strike,<video ms>,<audio ms>,<distance m>"
+	static void write(FILE* out, const Result& result);
+
+private:
+	ReplayAudio* audio;
+	ReplayFrames* frames;
+	const size_t audioBuffer;
+	Params params;
+
+	static void fuse(const SensorEvent& event, Fusion& fusion, Result& result);
+};
+
+#endif //THUNDER_DETECTOR_HOST_REPLAY_H
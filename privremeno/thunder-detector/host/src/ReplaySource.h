@@ -0,0 +1,27 @@
+#ifndef THUNDER_DETECTOR_HOST_REPLAYSOURCE_H
+#define THUNDER_DETECTOR_HOST_REPLAYSOURCE_H
+
+#include <Devices/AudioSource.h>
+#include <Devices/FrameSource.h>
+
+/**
+ * Audio input of a replay. Sample 0 is at time 0 of the replay timeline.
+ */
+class ReplayAudio : public AudioSource {
+public:
+	virtual bool finished() const = 0;
+};
+
+/**
+ * Video input of a replay, frames are timestamped on the same timeline as the audio.
+ */
+class ReplayFrames : public FrameSource {
+public:
+	/**
+	 * @param timestamp [us] of the frame the next getFrame() returns
+	 * @return false when no frames are left
+	 */
+	virtual bool peek(uint64_t& timestamp) = 0;
+};
+
+#endif //THUNDER_DETECTOR_HOST_REPLAYSOURCE_H
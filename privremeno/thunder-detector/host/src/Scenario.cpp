@@ -0,0 +1,93 @@
+#include "Scenario.h"
+#include <Fusion.h>
+#include <algorithm>
+
+static constexpr const char* ThunderNames[] = { "clap", "peal", "rumble" };
+
+//Random times in [start, end) at least 'spacing' apart, sorted. Fewer if they don't fit in a few tries.
+static std::vector<uint64_t> spread(Random& random, uint32_t count, uint64_t start, uint64_t end, uint64_t spacing){
+	std::vector<uint64_t> times;
+
+	for(uint32_t i = 0; i < count && end > start; i++){
+		for(int attempt = 0; attempt < 100; attempt++){
+			const uint64_t t = start + (uint64_t) (random.uniform() * (end - start));
+			const bool clear = std::none_of(times.begin(), times.end(), [&](uint64_t other){
+				return (t > other ? t - other : other - t) < spacing;
+			});
+			if(clear){
+				times.push_back(t);
+				break;
+			}
+		}
+	}
+
+	std::sort(times.begin(), times.end());
+	return times;
+}
+
+Scenario::Scenario(const Config& config) : config(config){
+	Random random(config.seed);
+
+	//the first second of audio only calibrates the clap detector, and the first frame only fills the buffer
+	const uint64_t start = 2000000;
+	const uint64_t end = (uint64_t) config.duration * 1000000;
+
+	for(const auto flash : spread(random, config.strikes, start, end, 1000000)){
+		Strike strike{};
+		strike.flash = flash;
+		strike.flashDuration = (uint32_t) random.uniform(80000, 400000);
+		strike.distance = random.uniform(config.minDistance, config.maxDistance);
+		strike.brightness = 40 + 160 * 2000 / (2000 + strike.distance);
+		strike.thunder = strike.distance < 2000 ? ThunderType::Clap : strike.distance < 6000 ? ThunderType::Peal : ThunderType::Rumble;
+		strike.thunderTime = flash + (uint64_t) (strike.distance * 1000000 / Fusion::V_sound);
+		strike.loudness = std::min(25000.0f * 500 / (500 + strike.distance), 30000.0f);
+		strikes.push_back(strike);
+	}
+
+	for(const auto time : spread(random, config.doorSlams, start, end, 1000000)){
+		distractors.push_back({ Distractor::Kind::DoorSlam, time, 150000, random.uniform(3000, 15000), 0 });
+	}
+	for(const auto time : spread(random, config.headlights, start, end, 5000000)){
+		distractors.push_back({ Distractor::Kind::Headlights, time, (uint32_t) random.uniform(1000000, 4000000), random.uniform(10, 40), random.uniform(0.2f, 0.8f) });
+	}
+
+	std::sort(distractors.begin(), distractors.end(), [](const auto& a, const auto& b){ return a.time < b.time; });
+}
+
+GroundTruth Scenario::getTruth() const{
+	GroundTruth truth;
+	const uint64_t end = (uint64_t) config.duration * 1000000;
+
+	for(const auto& strike : strikes){
+		truth.flashes.push_back(strike.flash);
+
+		//thunder of a late strike can fall past the end of the recording
+		if(strike.thunderTime < end){
+			truth.thunders.push_back(strike.thunderTime);
+			truth.strikes.push_back({ strike.flash, strike.thunderTime, strike.distance });
+		}
+	}
+
+	std::sort(truth.thunders.begin(), truth.thunders.end());
+	return truth;
+}
+
+void Scenario::writeTruth(FILE* out) const{
+	const uint64_t end = (uint64_t) config.duration * 1000000;
+
+	fprintf(out, "# synthetic scenario, seed %u, %u s\n", config.seed, config.duration);
+
+	for(const auto& strike : strikes){
+		fprintf(out, "flash,%llu\n", (unsigned long long) (strike.flash / 1000));
+		if(strike.thunderTime < end){
+			fprintf(out, "thunder,%llu,%s\n", (unsigned long long) (strike.thunderTime / 1000), ThunderNames[(int) strike.thunder]);
+			fprintf(out, "strike,%llu,%llu\n", (unsigned long long) (strike.flash / 1000), (unsigned long long) (strike.thunderTime / 1000));
+		}
+		fprintf(out, "# distance %.0f m\n", strike.distance);
+	}
+
+	for(const auto& distractor : distractors){
+		fprintf(out, "# %s,%llu,%llu\n", distractor.kind == Distractor::Kind::DoorSlam ? "doorslam" : "headlights",
+				(unsigned long long) (distractor.time / 1000), (unsigned long long) ((distractor.time + distractor.duration) / 1000));
+	}
+}
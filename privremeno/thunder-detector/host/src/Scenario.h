@@ -0,0 +1,94 @@
+#ifndef THUNDER_DETECTOR_HOST_SCENARIO_H
+#define THUNDER_DETECTOR_HOST_SCENARIO_H
+
+#include "Evaluation.h"
+#include <SensorEvent.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * Small xorshift generator. Synthetic sessions are defined by their seed alone, so unlike the <random>
+ * distributions the output must be identical on every platform and standard library.
+ */
+struct Random {
+	uint32_t state;
+
+	Random(uint32_t seed) : state(seed ? seed : 0x9E3779B9){ }
+
+	uint32_t next(){
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	//[0, 1)
+	float uniform(){
+		return (next() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	float uniform(float min, float max){
+		return min + (max - min) * uniform();
+	}
+
+	//Approximately normal, mean 0 and deviation 1
+	float noise(){
+		return (uniform() + uniform() + uniform() + uniform() - 2.0f) * 1.732f;
+	}
+};
+
+/**
+ * Randomised thunderstorm: lightning strikes at known distances with their thunder, and distractors that
+ * either detector may mistake for them. SyntheticAudio and SyntheticFrames render it, the timeline here
+ * is the exact ground truth.
+ */
+struct Scenario {
+	struct Config {
+		uint32_t seed = 1;
+		uint32_t duration = 300; //[s]
+		uint32_t sampleRate = 16000;
+		uint32_t fps = 20;
+		uint16_t width = 160, height = 120; //VisualDetector works on 160x120
+		uint32_t strikes = 10;
+		float minDistance = 300, maxDistance = 12000; //[m]
+		uint32_t doorSlams = 3; //audio distractor, same shape as a close clap
+		uint32_t headlights = 3; //video distractor, a lit area appearing and disappearing
+		float wind = 0.3f; //[0 - 1] gusty low-frequency noise
+		float rain = 0.3f; //[0 - 1] drop clicks
+	};
+
+	struct Strike {
+		uint64_t flash; //[us]
+		uint32_t flashDuration; //[us]
+		float brightness; //added luminance at the flash peak
+		float distance; //[m]
+		ThunderType thunder; //by distance: clap when close, peal, rumble when far
+		uint64_t thunderTime; //[us] flash + distance / speed of sound
+		float loudness; //peak amplitude of the thunder
+	};
+
+	struct Distractor {
+		enum class Kind {
+			DoorSlam, Headlights
+		} kind;
+		uint64_t time; //[us]
+		uint32_t duration; //[us]
+		float strength; //amplitude of a slam, radius [px] of headlights
+		float x; //headlights only, [0 - 1] horizontal position
+	};
+
+	Config config;
+	std::vector<Strike> strikes; //sorted by flash time
+	std::vector<Distractor> distractors; //sorted by time
+
+	Scenario(const Config& config);
+
+	//Annotations as the detectors should report them
+	GroundTruth getTruth() const;
+
+	//GroundTruth::load() format, distractors are written as comments
+	void writeTruth(FILE* out) const;
+};
+
+#endif //THUNDER_DETECTOR_HOST_SCENARIO_H
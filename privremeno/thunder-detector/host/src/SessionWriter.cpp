@@ -0,0 +1,88 @@
+#include "SessionWriter.h"
+#include <FrameFileFormat.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+bool SessionWriter::writeWav(const char* path, ReplayAudio& audio){
+	FILE* file = fopen(path, "wb");
+	if(!file){
+		fprintf(stderr, "Can't write %s\n", path);
+		return false;
+	}
+
+	const uint32_t rate = audio.getSampleRate();
+	const uint16_t format = 1, channels = 1, bits = 16, blockAlign = 2;
+	const uint32_t fmtSize = 16, byteRate = rate * blockAlign;
+	uint32_t dataSize = 0, riffSize = 0;
+
+	//sizes are patched once the length is known
+	fwrite("RIFF", 1, 4, file);
+	fwrite(&riffSize, 4, 1, file);
+	fwrite("WAVEfmt ", 1, 8, file);
+	fwrite(&fmtSize, 4, 1, file);
+	fwrite(&format, 2, 1, file);
+	fwrite(&channels, 2, 1, file);
+	fwrite(&rate, 4, 1, file);
+	fwrite(&byteRate, 4, 1, file);
+	fwrite(&blockAlign, 2, 1, file);
+	fwrite(&bits, 2, 1, file);
+	fwrite("data", 1, 4, file);
+	fwrite(&dataSize, 4, 1, file);
+
+	std::vector<int16_t> buffer(rate);
+	while(!audio.finished()){
+		const size_t n = audio.read(buffer.data(), buffer.size());
+		if(n == 0) break;
+		fwrite(buffer.data(), sizeof(int16_t), n, file);
+		dataSize += n * sizeof(int16_t);
+	}
+
+	riffSize = 36 + dataSize;
+	fseek(file, 4, SEEK_SET);
+	fwrite(&riffSize, 4, 1, file);
+	fseek(file, 40, SEEK_SET);
+	fwrite(&dataSize, 4, 1, file);
+
+	const bool ok = ferror(file) == 0;
+	fclose(file);
+	return ok;
+}
+
+bool SessionWriter::writeFrames(const char* path, ReplayFrames& frames){
+	FILE* file = fopen(path, "wb");
+	if(!file){
+		fprintf(stderr, "Can't write %s\n", path);
+		return false;
+	}
+
+	bool header = false;
+	uint64_t timestamp;
+
+	while(frames.peek(timestamp)){
+		camera_fb_t* frame = frames.getFrame();
+		if(frame == nullptr) break;
+
+		//format and size come from the first frame
+		if(!header){
+			FrameFileHeader fileHeader{};
+			memcpy(fileHeader.magic, FrameFileMagic, 4);
+			fileHeader.version = FrameFileVersion;
+			fileHeader.format = frame->format;
+			fileHeader.width = frame->width;
+			fileHeader.height = frame->height;
+			fwrite(&fileHeader, sizeof(fileHeader), 1, file);
+			header = true;
+		}
+
+		FrameFileEntry entry{ timestamp, (uint32_t) frame->len, 0 };
+		fwrite(&entry, sizeof(entry), 1, file);
+		fwrite(frame->buf, 1, frame->len, file);
+
+		frames.releaseFrame();
+	}
+
+	const bool ok = ferror(file) == 0;
+	fclose(file);
+	return ok;
+}
@@ -0,0 +1,18 @@
+#ifndef THUNDER_DETECTOR_HOST_SESSIONWRITER_H
+#define THUNDER_DETECTOR_HOST_SESSIONWRITER_H
+
+#include "ReplaySource.h"
+
+/**
+ * Drains replay sources into the files WavSource and FrameFileSource read back.
+ */
+class SessionWriter {
+public:
+	//16-bit mono PCM WAV with the same header as examples/recorder.c writes
+	static bool writeWav(const char* path, ReplayAudio& audio);
+
+	//FrameFile, see FrameFileFormat.h
+	static bool writeFrames(const char* path, ReplayFrames& frames);
+};
+
+#endif //THUNDER_DETECTOR_HOST_SESSIONWRITER_H
@@ -0,0 +1,131 @@
+#include "SyntheticAudio.h"
+#include <algorithm>
+#include <cmath>
+
+static constexpr float Pi = 3.14159265f;
+static constexpr float BackgroundNoise = 60; //deviation of the microphone noise floor
+static constexpr float WindFilter = 0.05f; //low-pass factor, cutoff of ~130 Hz at 16 kHz
+static constexpr float RumbleFilter = 0.01f; //cutoff of ~25 Hz
+static constexpr float RainRate = 30; //[drops/s] at rain = 1
+
+//Gain that brings white noise of deviation 1 low-passed by 'factor' back to deviation 1
+static float filterGain(float factor){
+	return 1.0f / std::sqrt(factor / (2 - factor));
+}
+
+SyntheticAudio::SyntheticAudio(const Scenario& scenario) :
+		scenario(scenario), length((uint64_t) scenario.config.duration * scenario.config.sampleRate),
+		random(scenario.config.seed * 2654435761u + 1){
+
+	gustPhase = random.uniform(0, 2 * Pi);
+	schedule();
+}
+
+void SyntheticAudio::schedule(){
+	const float rate = scenario.config.sampleRate;
+	const auto toSamples = [rate](uint64_t us){ return (uint64_t) (us * (double) rate / 1000000); };
+
+	const auto pulse = [&](uint64_t start, float amplitude, float tau, float frequency){
+		Sound sound{ Sound::Shape::Pulse, start, (uint64_t) (8 * tau * rate), amplitude, std::exp(-1.0f / (tau * rate)), 2 * Pi * frequency / rate };
+		pending.push_back(sound);
+	};
+	const auto noise = [&](uint64_t start, float amplitude, float attack, float duration){
+		Sound sound{ Sound::Shape::Noise, start, (uint64_t) (duration * rate), amplitude, attack * rate, 0 };
+		pending.push_back(sound);
+	};
+
+	for(const auto& strike : scenario.strikes){
+		const auto start = toSamples(strike.thunderTime);
+
+		switch(strike.thunder){
+			case ThunderType::Clap:
+				pulse(start, strike.loudness, 0.012f, 80);
+				noise(start, strike.loudness * 0.1f, 0.05f, 1.0f);
+				break;
+
+			case ThunderType::Peal:{
+				//a few claps in quick succession over a louder tail
+				const int count = 3 + (int) (random.uniform() * 4);
+				uint64_t offset = 0;
+				for(int i = 0; i < count; i++){
+					pulse(start + offset, strike.loudness * random.uniform(0.3f, 1.0f), 0.015f, random.uniform(50, 120));
+					offset += (uint64_t) (random.uniform(0.05f, 0.25f) * rate);
+				}
+				noise(start, strike.loudness * 0.3f, 0.1f, 1.5f);
+				break;
+			}
+
+			case ThunderType::Rumble:
+				noise(start, strike.loudness * 0.6f, 0.3f, random.uniform(2, 6));
+				break;
+		}
+	}
+
+	for(const auto& distractor : scenario.distractors){
+		if(distractor.kind != Scenario::Distractor::Kind::DoorSlam) continue;
+
+		const auto start = toSamples(distractor.time);
+		pulse(start, distractor.strength, 0.006f, 150);
+		pulse(start + (uint64_t) (0.08f * rate), distractor.strength * 0.3f, 0.004f, 300); //rattle
+	}
+
+	std::sort(pending.begin(), pending.end(), [](const Sound& a, const Sound& b){ return a.start > b.start; });
+}
+
+float SyntheticAudio::sample(Sound& sound, uint64_t t){
+	switch(sound.shape){
+		case Sound::Shape::Pulse:
+			return sound.amplitude * std::pow(sound.decay, (float) t) * std::cos(sound.phaseStep * t);
+
+		case Sound::Shape::Noise:{
+			sound.filter += RumbleFilter * (random.noise() - sound.filter);
+			const float envelope = t < sound.decay ? t / sound.decay : std::exp(-3.0f * (t - sound.decay) / (sound.length - sound.decay));
+			return sound.amplitude * envelope * sound.filter * filterGain(RumbleFilter);
+		}
+	}
+	return 0;
+}
+
+size_t SyntheticAudio::read(int16_t* buffer, size_t count){
+	const float rate = scenario.config.sampleRate;
+	const float windGain = filterGain(WindFilter);
+	const float dropChance = scenario.config.rain * RainRate / rate;
+
+	count = (size_t) std::min<uint64_t>(count, length - position);
+
+	for(size_t i = 0; i < count; i++, position++){
+		while(!pending.empty() && pending.back().start <= position){
+			playing.push_back(pending.back());
+			pending.pop_back();
+		}
+
+		if(random.uniform() < dropChance){
+			const float amplitude = random.uniform(300, 300 + 3000 * scenario.config.rain);
+			playing.push_back({ Sound::Shape::Pulse, position, (uint64_t) (0.004f * rate), amplitude, std::exp(-1.0f / (0.0005f * rate)), 2 * Pi * 2000 / rate });
+		}
+
+		float value = BackgroundNoise * random.noise();
+
+		//gusts come and go over tens of seconds
+		wind += WindFilter * (random.noise() - wind);
+		const float gust = 0.5f + 0.5f * std::sin(2 * Pi * 0.05f * position / rate + gustPhase);
+		value += scenario.config.wind * 1500 * gust * gust * wind * windGain;
+
+		for(auto& sound : playing){
+			value += sample(sound, position - sound.start);
+		}
+		playing.erase(std::remove_if(playing.begin(), playing.end(), [this](const Sound& s){ return position - s.start >= s.length; }), playing.end());
+
+		buffer[i] = (int16_t) std::clamp(value, -32768.0f, 32767.0f);
+	}
+
+	return count;
+}
+
+uint32_t SyntheticAudio::getSampleRate() const{
+	return scenario.config.sampleRate;
+}
+
+bool SyntheticAudio::finished() const{
+	return position >= length;
+}
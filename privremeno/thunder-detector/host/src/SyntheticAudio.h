@@ -0,0 +1,49 @@
+#ifndef THUNDER_DETECTOR_HOST_SYNTHETICAUDIO_H
+#define THUNDER_DETECTOR_HOST_SYNTHETICAUDIO_H
+
+#include "ReplaySource.h"
+#include "Scenario.h"
+#include <vector>
+
+/**
+ * Renders the audio of a Scenario on the fly, in the recorder's 16-bit mono format: background noise,
+ * wind and rain, thunder of every strike and door slams. Nothing is kept beyond the sounds playing
+ * at the moment, so arbitrarily long scenarios need no memory or disk.
+ */
+class SyntheticAudio : public ReplayAudio {
+public:
+	SyntheticAudio(const Scenario& scenario);
+
+	size_t read(int16_t* buffer, size_t count) override;
+	uint32_t getSampleRate() const override;
+	bool finished() const override;
+
+private:
+	struct Sound {
+		enum class Shape {
+			Pulse, //exponentially decaying low tone: clap, door slam, rain drop
+			Noise //low-passed noise with slow attack and decay: rumble
+		} shape;
+		uint64_t start; //[samples]
+		uint64_t length; //[samples]
+		float amplitude;
+		float decay; //Pulse: per-sample envelope factor, Noise: attack [samples]
+		float phaseStep; //Pulse: [rad/sample]
+		float filter = 0; //Noise: low-pass state
+	};
+
+	const Scenario& scenario;
+	const uint64_t length; //[samples]
+	uint64_t position = 0;
+
+	Random random;
+	std::vector<Sound> pending; //sorted by start, latest first so the next one pops off the back
+	std::vector<Sound> playing;
+	float wind = 0; //low-pass state
+	float gustPhase;
+
+	void schedule();
+	float sample(Sound& sound, uint64_t t);
+};
+
+#endif //THUNDER_DETECTOR_HOST_SYNTHETICAUDIO_H
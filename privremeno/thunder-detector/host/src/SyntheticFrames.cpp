@@ -0,0 +1,109 @@
+#include "SyntheticFrames.h"
+#include <algorithm>
+#include <cmath>
+
+static constexpr float SensorNoise = 2.5f; //deviation of the per-frame pixel noise
+static constexpr float SkyHeight = 0.6f; //upper part of the frame, lit fully by a flash
+static constexpr float GroundLight = 0.5f; //share of the flash reaching the ground part
+static constexpr float HeadlightBrightness = 120;
+static constexpr float ReadoutShare = 0.9f; //rolling shutter, rows are read out over this much of the frame period
+
+SyntheticFrames::SyntheticFrames(const Scenario& scenario) :
+		scenario(scenario), count((uint32_t) ((uint64_t) scenario.config.duration * scenario.config.fps)),
+		random(scenario.config.seed * 40503u + 7){
+
+	const auto& config = scenario.config;
+	scene.resize(config.width * config.height);
+	data.resize(config.width * config.height * 2);
+
+	//dark sky getting brighter towards the lit ground, with some fixed texture
+	for(uint32_t y = 0; y < config.height; y++){
+		for(uint32_t x = 0; x < config.width; x++){
+			scene[y * config.width + x] = 20 + 30.0f * y / config.height + random.uniform(-5, 5);
+		}
+	}
+
+	frame.buf = data.data();
+	frame.len = data.size();
+	frame.width = config.width;
+	frame.height = config.height;
+	frame.format = PIXFORMAT_RGB565;
+}
+
+uint64_t SyntheticFrames::frameTime(uint32_t frame) const{
+	return (uint64_t) frame * 1000000 / scenario.config.fps;
+}
+
+float SyntheticFrames::flashAt(uint64_t time, float flicker) const{
+	float brightness = 0;
+
+	for(const auto& strike : scenario.strikes){
+		if(time < strike.flash || time >= strike.flash + strike.flashDuration) continue;
+
+		//return strokes make the flash flicker while it fades
+		const float fade = std::exp(-3.0f * (time - strike.flash) / strike.flashDuration);
+		brightness += strike.brightness * fade * flicker;
+	}
+
+	return brightness;
+}
+
+camera_fb_t* SyntheticFrames::getFrame(){
+	if(index >= count) return nullptr;
+
+	const auto& config = scenario.config;
+	const uint64_t time = frameTime(index);
+	const float flicker = random.uniform(0.6f, 1.0f);
+	const float rowTime = ReadoutShare * 1000000 / config.fps / config.height; //[us]
+
+	std::vector<float> lit(scene.size(), 0);
+	for(const auto& distractor : scenario.distractors){
+		if(distractor.kind != Scenario::Distractor::Kind::Headlights) continue;
+		if(time < distractor.time || time >= distractor.time + distractor.duration) continue;
+
+		//a lit patch drifting sideways, switched on and off at once
+		const float progress = (float) (time - distractor.time) / distractor.duration;
+		const float cx = (distractor.x + 0.1f * progress) * config.width;
+		const float cy = 0.8f * config.height;
+		const float radius = distractor.strength;
+
+		for(uint32_t y = 0; y < config.height; y++){
+			for(uint32_t x = 0; x < config.width; x++){
+				const float d = std::hypot(x - cx, y - cy);
+				if(d < radius){
+					lit[y * config.width + x] += HeadlightBrightness * std::min(1.0f, (radius - d) / 2);
+				}
+			}
+		}
+	}
+
+	const uint32_t skyRows = (uint32_t) (SkyHeight * config.height);
+	for(uint32_t y = 0; y < config.height; y++){
+		//each row sees the flash as it is when the row is read out
+		const float flash = flashAt(time + (uint64_t) (y * rowTime), flicker);
+		const float flashHere = y < skyRows ? flash : flash * GroundLight;
+
+		for(uint32_t x = 0; x < config.width; x++){
+			const size_t i = y * config.width + x;
+			const float value = scene[i] + lit[i] + flashHere + SensorNoise * random.noise();
+			const auto luminance = (uint8_t) std::clamp(value, 0.0f, 255.0f);
+
+			const uint16_t color = ((luminance >> 3) << 11) | ((luminance >> 2) << 5) | (luminance >> 3);
+			data[2 * i] = color >> 8;
+			data[2 * i + 1] = color & 0xFF;
+		}
+	}
+
+	frame.timestamp.tv_sec = time / 1000000;
+	frame.timestamp.tv_usec = time % 1000000;
+
+	index++;
+	return &frame;
+}
+
+void SyntheticFrames::releaseFrame(){ }
+
+bool SyntheticFrames::peek(uint64_t& timestamp){
+	timestamp = frameTime(index);
+	return index < count;
+}
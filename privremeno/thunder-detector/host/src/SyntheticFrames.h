@@ -0,0 +1,35 @@
+#ifndef THUNDER_DETECTOR_HOST_SYNTHETICFRAMES_H
+#define THUNDER_DETECTOR_HOST_SYNTHETICFRAMES_H
+
+#include "ReplaySource.h"
+#include "Scenario.h"
+#include <vector>
+
+/**
+ * Renders the frames of a Scenario on the fly as big-endian RGB565, like the camera delivers them:
+ * a dim night scene with sensor noise, lightning flashes lighting up mostly the sky, and headlights.
+ * Rows are read out one after another like on a rolling shutter sensor, so a flash starts partway down a frame.
+ */
+class SyntheticFrames : public ReplayFrames {
+public:
+	SyntheticFrames(const Scenario& scenario);
+
+	camera_fb_t* getFrame() override;
+	void releaseFrame() override;
+	bool peek(uint64_t& timestamp) override;
+
+private:
+	const Scenario& scenario;
+	const uint32_t count; //frames in the scenario
+	uint32_t index = 0;
+
+	Random random;
+	std::vector<float> scene; //luminance of the static scene
+	std::vector<uint8_t> data;
+	camera_fb_t frame{};
+
+	uint64_t frameTime(uint32_t frame) const;
+	float flashAt(uint64_t time, float flicker) const;
+};
+
+#endif //THUNDER_DETECTOR_HOST_SYNTHETICFRAMES_H
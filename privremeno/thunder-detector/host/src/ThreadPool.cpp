@@ -0,0 +1,103 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(size_t threads){
+	if(threads == 0){
+		threads = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	for(size_t i = 0; i < threads; i++){
+		workers.push_back(std::make_unique<Worker>());
+	}
+	for(size_t i = 0; i < threads; i++){
+		this->threads.emplace_back(&ThreadPool::run, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool(){
+	wait();
+
+	{
+		std::lock_guard lock(stateMutex);
+		stopping = true;
+	}
+	jobAvailable.notify_all();
+
+	for(auto& thread : threads){
+		thread.join();
+	}
+}
+
+void ThreadPool::submit(std::function<void()> job){
+	auto& worker = *workers[next++ % workers.size()];
+	{
+		std::lock_guard lock(worker.mutex);
+		worker.jobs.push_back(std::move(job));
+	}
+
+	{
+		std::lock_guard lock(stateMutex);
+		queued++;
+		pending++;
+	}
+	jobAvailable.notify_one();
+}
+
+void ThreadPool::wait(){
+	std::unique_lock lock(stateMutex);
+	allDone.wait(lock, [this](){ return pending == 0; });
+}
+
+size_t ThreadPool::getThreadCount() const{
+	return threads.size();
+}
+
+void ThreadPool::run(size_t self){
+	std::function<void()> job;
+
+	for(;;){
+		{
+			std::unique_lock lock(stateMutex);
+			jobAvailable.wait(lock, [this](){ return stopping || queued > 0; });
+			if(stopping) return;
+			queued--; //claims a job - it was pushed to a deque before being counted, so one is there to take
+		}
+
+		//a single pass can race with other thieves moving through the deques, but never comes up empty for long
+		while(!take(self, job)){
+			std::this_thread::yield();
+		}
+
+		job();
+		job = nullptr;
+
+		std::lock_guard lock(stateMutex);
+		if(--pending == 0){
+			allDone.notify_all();
+		}
+	}
+}
+
+bool ThreadPool::take(size_t self, std::function<void()>& job){
+	{
+		auto& own = *workers[self];
+		std::lock_guard lock(own.mutex);
+		if(!own.jobs.empty()){
+			job = std::move(own.jobs.back());
+			own.jobs.pop_back();
+			return true;
+		}
+	}
+
+	for(size_t i = 1; i < workers.size(); i++){
+		auto& victim = *workers[(self + i) % workers.size()];
+		std::lock_guard lock(victim.mutex);
+		if(!victim.jobs.empty()){
+			job = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
@@ -0,0 +1,56 @@
+#ifndef THUNDER_DETECTOR_HOST_THREADPOOL_H
+#define THUNDER_DETECTOR_HOST_THREADPOOL_H
+
+#include <functional>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+/**
+ * Work-stealing thread pool. Every worker has its own job deque, taking from its back and
+ * stealing from the front of the others' when it runs dry, so sessions of very different
+ * lengths still keep all cores busy until the end.
+ */
+class ThreadPool {
+public:
+	/**
+	 * @param threads number of workers, 0 for one per hardware thread
+	 */
+	ThreadPool(size_t threads = 0);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	void submit(std::function<void()> job);
+
+	//Blocks until all submitted jobs have finished
+	void wait();
+
+	size_t getThreadCount() const;
+
+private:
+	struct Worker {
+		std::mutex mutex;
+		std::deque<std::function<void()>> jobs;
+	};
+
+	void run(size_t self);
+	bool take(size_t self, std::function<void()>& job);
+
+	std::vector<std::unique_ptr<Worker>> workers;
+	std::vector<std::thread> threads;
+	std::atomic<size_t> next = 0; //round-robin target of submit()
+
+	std::mutex stateMutex;
+	std::condition_variable jobAvailable, allDone;
+	size_t queued = 0; //jobs waiting in any deque
+	size_t pending = 0; //jobs submitted but not finished
+	bool stopping = false;
+};
+
+#endif //THUNDER_DETECTOR_HOST_THREADPOOL_H
@@ -0,0 +1,159 @@
+#include "WavSource.h"
+#include <cstring>
+#include <algorithm>
+
+WavSource::WavSource(const char* path){
+	file = fopen(path, "rb");
+	if(!file) return;
+
+	char riff[12];
+	if(fread(riff, 1, sizeof(riff), file) != sizeof(riff) || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0){
+		fprintf(stderr, "%s: not a WAV file\n", path);
+		fclose(file);
+		file = nullptr;
+		return;
+	}
+
+	bool format = false;
+	for(;;){
+		char id[4];
+		uint32_t size;
+		if(fread(id, 1, 4, file) != 4 || fread(&size, 4, 1, file) != 1) break;
+
+		if(memcmp(id, "fmt ", 4) == 0){
+			uint16_t audioFormat, channels, blockAlign, bits, extraSize = 0, blockSamples = 0;
+			uint32_t rate, byteRate;
+			if(fread(&audioFormat, 2, 1, file) != 1 || fread(&channels, 2, 1, file) != 1 || fread(&rate, 4, 1, file) != 1 ||
+			   fread(&byteRate, 4, 1, file) != 1 || fread(&blockAlign, 2, 1, file) != 1 || fread(&bits, 2, 1, file) != 1) break;
+			if(size >= 20 && (fread(&extraSize, 2, 1, file) != 1 || fread(&blockSamples, 2, 1, file) != 1)) break;
+
+			if(audioFormat == WavFormatImaAdpcm && channels == 1 && blockAlign == AdpcmBlockBytes && blockSamples == AdpcmBlockSamples){
+				codec = AudioCodec::ImaAdpcm;
+			}else if(audioFormat == WavFormatLossless && channels == 1 && bits == 16 && blockSamples == LosslessBlockSamples){
+				codec = AudioCodec::Lossless;
+			}else if(audioFormat != WavFormatPcm || channels != 1 || bits != 16){
+				fprintf(stderr, "%s: only 16-bit mono PCM, IMA ADPCM in %zu B blocks and lossless are supported (format %u, %u channels, %u bits)\n",
+						path, AdpcmBlockBytes, audioFormat, channels, bits);
+				break;
+			}
+			sampleRate = rate;
+			format = true;
+			fseek(file, size - (size >= 20 ? 20 : 16) + (size & 1), SEEK_CUR);
+
+		}else if(memcmp(id, "fact", 4) == 0 && size >= 4){
+			uint32_t samples;
+			if(fread(&samples, 4, 1, file) != 1) break;
+			length = samples;
+			fseek(file, size - 4 + (size & 1), SEEK_CUR);
+
+		}else if(memcmp(id, "data", 4) == 0){
+			if(!format) break;
+
+			//the recorder patches the sizes when it closes a file, a cut-off recording has them at 0 or has less data than declared
+			const long start = ftell(file);
+			fseek(file, 0, SEEK_END);
+			const size_t available = ftell(file) - start;
+			fseek(file, start, SEEK_SET);
+			const size_t bytes = size > 0 ? std::min<size_t>(size, available) : available;
+
+			if(codec == AudioCodec::Pcm){
+				length = remaining = bytes / sizeof(int16_t);
+				return;
+			}
+
+			decoder.emplace(codec);
+			dataRemaining = bytes;
+			remaining = length > 0 ? length : SIZE_MAX;
+			if(!decodeBlock()){
+				remaining = 0;
+			}
+			return;
+
+		}else{
+			fseek(file, size + (size & 1), SEEK_CUR);
+		}
+	}
+
+	fprintf(stderr, "%s: no usable fmt/data chunks\n", path);
+	fclose(file);
+	file = nullptr;
+}
+
+WavSource::~WavSource(){
+	if(file) fclose(file);
+}
+
+bool WavSource::isOpen() const{
+	return file != nullptr;
+}
+
+size_t WavSource::read(int16_t* buffer, size_t count){
+	if(!file) return 0;
+
+	if(!decoder){
+		const size_t n = fread(buffer, sizeof(int16_t), std::min(count, remaining), file);
+		remaining -= n;
+		return n;
+	}
+
+	size_t total = 0;
+	while(total < count && remaining > 0){
+		const size_t n = std::min({ count - total, remaining, decoded.size() - decodedPos });
+		memcpy(buffer + total, decoded.data() + decodedPos, n * sizeof(int16_t));
+		decodedPos += n;
+		remaining -= n;
+		total += n;
+
+		//decoding ahead keeps finished() exact for recordings without a sample count
+		if(decodedPos == decoded.size() && remaining > 0 && !decodeBlock()){
+			remaining = 0;
+		}
+	}
+	return total;
+}
+
+bool WavSource::decodeBlock(){
+	uint8_t header[AudioDecoder::BlockHeaderBytes];
+	if(dataRemaining < sizeof(header) || fread(header, 1, sizeof(header), file) != sizeof(header)) return false;
+
+	const size_t size = decoder->blockSize(header);
+	if(size < sizeof(header)){
+		fprintf(stderr, "invalid block, %zu B of data left\n", dataRemaining);
+		return false;
+	}
+	if(size > dataRemaining){
+		fprintf(stderr, "last block is cut off\n");
+		return false;
+	}
+
+	block.resize(size);
+	memcpy(block.data(), header, sizeof(header));
+	if(fread(block.data() + sizeof(header), 1, size - sizeof(header), file) != size - sizeof(header)) return false;
+	dataRemaining -= size;
+
+	decoded.resize(decoder->maxBlockSamples());
+	const size_t samples = decoder->decode(block.data(), size, decoded.data());
+	if(samples == 0){
+		fprintf(stderr, "corrupt block, %zu B of data left\n", dataRemaining);
+		return false;
+	}
+	decoded.resize(samples);
+	decodedPos = 0;
+	return true;
+}
+
+uint32_t WavSource::getSampleRate() const{
+	return sampleRate;
+}
+
+bool WavSource::finished() const{
+	return remaining == 0;
+}
+
+size_t WavSource::getLength() const{
+	return length;
+}
+
+AudioCodec WavSource::getCodec() const{
+	return codec;
+}
@@ -0,0 +1,47 @@
+#ifndef THUNDER_DETECTOR_HOST_WAVSOURCE_H
+#define THUNDER_DETECTOR_HOST_WAVSOURCE_H
+
+#include "ReplaySource.h"
+#include <Util/AudioCodec.h>
+#include <cstdio>
+#include <vector>
+#include <optional>
+
+/**
+ * Reads a 16-bit mono WAV file as written by examples/recorder.cpp - PCM, IMA ADPCM or lossless (Util/AudioCodec.h).
+ */
+class WavSource : public ReplayAudio {
+public:
+	WavSource(const char* path);
+	~WavSource() override;
+
+	//false if the file couldn't be opened or isn't 16-bit mono in one of the AudioCodec formats
+	bool isOpen() const;
+
+	size_t read(int16_t* buffer, size_t count) override;
+	uint32_t getSampleRate() const override;
+	bool finished() const override;
+
+	//Number of samples in the file, 0 if a compressed recording was cut off before its header was written
+	size_t getLength() const;
+
+	AudioCodec getCodec() const;
+
+private:
+	FILE* file = nullptr;
+	AudioCodec codec = AudioCodec::Pcm;
+	uint32_t sampleRate = 0;
+	size_t remaining = 0;
+	size_t length = 0;
+
+	//compressed formats are decoded a block at a time
+	std::optional<AudioDecoder> decoder;
+	size_t dataRemaining = 0; //[B]
+	std::vector<uint8_t> block;
+	std::vector<int16_t> decoded;
+	size_t decodedPos = 0;
+
+	bool decodeBlock();
+};
+
+#endif //THUNDER_DETECTOR_HOST_WAVSOURCE_H
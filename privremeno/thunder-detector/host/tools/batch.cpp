@@ -0,0 +1,268 @@
+//Runs an archive of recorded sessions through independent detector instances on all cores and scores the
+//detections against ground-truth annotations, optionally sweeping the detector thresholds.
+//Usage: batch [-j threads] [-b buffer_samples] [-t tolerance_ms] [-o out_dir] [-s param=from[:to:step]]... archive_dir
+//Every subdirectory of archive_dir is a session with audio.wav and/or frames.thf, and truth.csv (see Evaluation.h).
+//Sweepable params: spike, decay (clap thresholds of AudioDetector), noise, threshold, sigma, shift, gates, calibrate (VisualDetector).
+//Prints one CSV line of scores over all sessions per parameter combination. With -o the events of every
+//session are written to out_dir/<session>.csv, or out_dir/<n>/<session>.csv when sweeping, n being the
+//0-based line of the printed scores.
+
+#include "Replay.h"
+#include "Evaluation.h"
+#include "ThreadPool.h"
+#include "WavSource.h"
+#include "FrameFileSource.h"
+#include <esp_log.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <memory>
+#include <cstring>
+#include <cstdlib>
+
+namespace fs = std::filesystem;
+
+struct Session {
+	std::string name;
+	fs::path audio, frames, truth; //empty if not present
+};
+
+struct Sweep {
+	std::string param;
+	std::vector<double> values;
+};
+
+static const char* Params[] = { "spike", "decay", "noise", "threshold", "sigma", "shift", "gates", "calibrate" };
+
+static bool parseSweep(const char* arg, Sweep& sweep){
+	const char* eq = strchr(arg, '=');
+	if(eq == nullptr) return false;
+
+	sweep.param = std::string(arg, eq);
+	if(std::find_if(std::begin(Params), std::end(Params), [&](const char* p){ return sweep.param == p; }) == std::end(Params)){
+		return false;
+	}
+
+	double from = 0, to = 0, step = 0;
+	const int n = sscanf(eq + 1, "%lf:%lf:%lf", &from, &to, &step);
+	if(n == 1){
+		sweep.values = { from };
+		return true;
+	}
+	if(n != 3 || step <= 0 || to < from) return false;
+
+	//half a step of slack so float steps don't lose the last value
+	for(double v = from; v <= to + step / 2; v += step){
+		sweep.values.push_back(v);
+	}
+	return true;
+}
+
+static void apply(Replay::Params& params, const std::string& param, double value){
+	if(param == "spike"){
+		params.audio.clapSpikeThreshold = (int16_t) value;
+	}else if(param == "decay"){
+		params.audio.clapDecayThreshold = (int16_t) value;
+	}else if(param == "noise"){
+		params.video.noiseCutoff = (uint8_t) value;
+	}else if(param == "threshold"){
+		params.video.detectionThreshold = (float) value;
+	}else if(param == "sigma"){
+		params.video.deviationSigma = (float) value;
+	}else if(param == "shift"){
+		params.video.backgroundShift = (uint8_t) value;
+	}else if(param == "gates"){
+		params.video.gates = value != 0;
+	}else if(param == "calibrate"){
+		params.video.calibrate = value != 0;
+	}
+}
+
+//Cartesian product of all sweeps, a single default combination without any
+static std::vector<Replay::Params> combinations(const std::vector<Sweep>& sweeps){
+	std::vector<Replay::Params> result(1);
+
+	for(const auto& sweep : sweeps){
+		std::vector<Replay::Params> expanded;
+		for(const auto& params : result){
+			for(double value : sweep.values){
+				auto p = params;
+				apply(p, sweep.param, value);
+				expanded.push_back(p);
+			}
+		}
+		result = std::move(expanded);
+	}
+
+	return result;
+}
+
+static std::vector<Session> findSessions(const fs::path& archive){
+	std::vector<Session> sessions;
+
+	for(const auto& entry : fs::directory_iterator(archive)){
+		if(!entry.is_directory()) continue;
+
+		Session session;
+		session.name = entry.path().filename().string();
+		if(fs::exists(entry.path() / "audio.wav")) session.audio = entry.path() / "audio.wav";
+		if(fs::exists(entry.path() / "frames.thf")) session.frames = entry.path() / "frames.thf";
+		if(fs::exists(entry.path() / "truth.csv")) session.truth = entry.path() / "truth.csv";
+
+		if(session.audio.empty() && session.frames.empty()) continue;
+		sessions.push_back(std::move(session));
+	}
+
+	std::sort(sessions.begin(), sessions.end(), [](const auto& a, const auto& b){ return a.name < b.name; });
+	return sessions;
+}
+
+int main(int argc, char** argv){
+	size_t threads = 0;
+	size_t buffer = 16000;
+	size_t tolerance = 250;
+	const char* outDir = nullptr;
+	const char* archive = nullptr;
+	std::vector<Sweep> sweeps;
+
+	for(int i = 1; i < argc; i++){
+		Sweep sweep;
+		if(strcmp(argv[i], "-j") == 0 && i + 1 < argc){
+			threads = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-b") == 0 && i + 1 < argc && strtoul(argv[i + 1], nullptr, 10) > 0){
+			buffer = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+			tolerance = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-o") == 0 && i + 1 < argc){
+			outDir = argv[++i];
+		}else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc && parseSweep(argv[i + 1], sweep)){
+			sweeps.push_back(std::move(sweep));
+			i++;
+		}else if(argv[i][0] != '-' && archive == nullptr){
+			archive = argv[i];
+		}else{
+			fprintf(stderr, "Usage: %s [-j threads] [-b buffer_samples] [-t tolerance_ms] [-o out_dir] "
+							"[-s spike|decay|noise|threshold|sigma|shift|gates|calibrate=from[:to:step]]... archive_dir\n", argv[0]);
+			return 1;
+		}
+	}
+
+	if(archive == nullptr || !fs::is_directory(archive)){
+		fprintf(stderr, "No archive directory given\n");
+		return 1;
+	}
+
+	esp_log_level_set("*", ESP_LOG_WARN);
+
+	const auto sessions = findSessions(archive);
+	if(sessions.empty()){
+		fprintf(stderr, "No sessions in %s\n", archive);
+		return 1;
+	}
+
+	//annotations are shared by all combinations, load them once
+	std::vector<GroundTruth> truths(sessions.size());
+	size_t annotated = 0;
+	for(size_t s = 0; s < sessions.size(); s++){
+		if(sessions[s].truth.empty()) continue;
+		if(!truths[s].load(sessions[s].truth.c_str())) return 1;
+		annotated++;
+	}
+
+	const auto sets = combinations(sweeps);
+
+	std::vector<std::string> eventDirs(sets.size());
+	if(outDir){
+		for(size_t k = 0; k < sets.size(); k++){
+			eventDirs[k] = sets.size() == 1 ? outDir : (fs::path(outDir) / std::to_string(k)).string();
+			fs::create_directories(eventDirs[k]);
+		}
+	}
+
+	//[combination][session], every job writes only its own slot
+	std::vector<std::vector<Evaluation>> scores(sets.size(), std::vector<Evaluation>(sessions.size()));
+	std::vector<std::vector<uint64_t>> durations(sets.size(), std::vector<uint64_t>(sessions.size()));
+	std::atomic<bool> failed = false;
+
+	const auto start = std::chrono::steady_clock::now();
+	{
+		ThreadPool pool(threads);
+		fprintf(stderr, "%zu sessions (%zu annotated) x %zu combinations on %zu threads\n",
+				sessions.size(), annotated, sets.size(), pool.getThreadCount());
+
+		for(size_t k = 0; k < sets.size(); k++){
+			for(size_t s = 0; s < sessions.size(); s++){
+				pool.submit([&, k, s](){
+					const auto& session = sessions[s];
+
+					std::unique_ptr<WavSource> audio;
+					if(!session.audio.empty()){
+						audio = std::make_unique<WavSource>(session.audio.c_str());
+						if(!audio->isOpen()){
+							failed = true;
+							return;
+						}
+					}
+
+					std::unique_ptr<FrameFileSource> frames;
+					if(!session.frames.empty()){
+						frames = std::make_unique<FrameFileSource>(session.frames.c_str());
+						if(!frames->isOpen()){
+							failed = true;
+							return;
+						}
+					}
+
+					Replay replay(audio.get(), frames.get(), buffer);
+					replay.setParams(sets[k]);
+					const auto result = replay.run();
+
+					durations[k][s] = result.duration;
+					if(!session.truth.empty()){
+						scores[k][s] = Evaluation::evaluate(result, truths[s], tolerance);
+					}
+
+					if(outDir){
+						const auto path = fs::path(eventDirs[k]) / (session.name + ".csv");
+						FILE* out = fopen(path.c_str(), "w");
+						if(out == nullptr){
+							fprintf(stderr, "Can't write %s\n", path.c_str());
+							failed = true;
+							return;
+						}
+						Replay::write(out, result);
+						fclose(out);
+					}
+				});
+			}
+		}
+
+		pool.wait();
+	}
+
+	const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	printf("spike,decay,noise,threshold,sigma,shift,gates,calibrate,");
+	Evaluation::writeHeader(stdout);
+
+	uint64_t replayed = 0;
+	for(size_t k = 0; k < sets.size(); k++){
+		Evaluation total;
+		for(size_t s = 0; s < sessions.size(); s++){
+			total.add(scores[k][s]);
+			replayed += durations[k][s];
+		}
+
+		const auto& p = sets[k];
+		printf("%d,%d,%u,%.3f,%.2f,%u,%d,%d,", p.audio.clapSpikeThreshold, p.audio.clapDecayThreshold, p.video.noiseCutoff, p.video.detectionThreshold,
+			   p.video.deviationSigma, p.video.backgroundShift, p.video.gates, p.video.calibrate);
+		total.write(stdout);
+	}
+
+	fprintf(stderr, "replayed %.1f s in %.3f s (%.0fx real time)\n", replayed / 1e6, wall, wall > 0 ? replayed / 1e6 / wall : 0.0);
+
+	return failed ? 1 : 0;
+}
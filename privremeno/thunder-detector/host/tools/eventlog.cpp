@@ -0,0 +1,77 @@
+//Prints the binary event log (CONFIG_EVENT_LOG) as CSV, one line per record:
+//"<boot>,<ms>,video,<intensity>", "<boot>,<ms>,audio,<type>", "<boot>,<ms>,strike,<audio ms>,<distance m>"
+//and with -y also "<boot>,<ms>,sync,<dropped records>". -B/-s/-t select one boot from/to a time [ms].
+//Usage: eventlog [-y] [-B boot] [-s from_ms] [-t to_ms] events.bin
+
+#include "EventLogReader.h"
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <cinttypes>
+
+static constexpr const char* ThunderNames[] = { "clap", "peal", "rumble" };
+
+int main(int argc, char** argv){
+	const char* path = nullptr;
+	bool syncs = false;
+	bool range = false;
+	uint32_t boot = 0;
+	uint64_t from = 0, to = UINT64_MAX;
+
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-y") == 0){
+			syncs = true;
+		}else if(strcmp(argv[i], "-B") == 0 && i + 1 < argc){
+			boot = strtoul(argv[++i], nullptr, 10);
+			range = true;
+		}else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc){
+			from = strtoull(argv[++i], nullptr, 10);
+			range = true;
+		}else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+			to = strtoull(argv[++i], nullptr, 10);
+			range = true;
+		}else if(argv[i][0] != '-' && path == nullptr){
+			path = argv[i];
+		}else{
+			path = nullptr;
+			break;
+		}
+	}
+
+	if(path == nullptr){
+		fprintf(stderr, "Usage: %s [-y] [-B boot] [-s from_ms] [-t to_ms] events.bin\n", argv[0]);
+		return 1;
+	}
+
+	EventLogReader log(path);
+	if(!log.isOpen()) return 1;
+
+	size_t printed = 0;
+	if(!range || log.seek(boot, from)){
+		EventRecord record;
+		while(log.next(record)){
+			if(range && (record.boot != boot || record.timestamp > to)) break;
+
+			switch(record.type){
+				case EventRecordType::Sync:
+					if(!syncs) continue;
+					printf("%" PRIu32 ",%" PRIu64 ",sync,%" PRIu64 "\n", record.boot, record.timestamp, record.audioTimestamp);
+					break;
+				case EventRecordType::Video:
+					printf("%" PRIu32 ",%" PRIu64 ",video,%u\n", record.boot, record.timestamp, record.value);
+					break;
+				case EventRecordType::Audio:
+					printf("%" PRIu32 ",%" PRIu64 ",audio,%s\n", record.boot, record.timestamp, record.value < 3 ? ThunderNames[record.value] : "?");
+					break;
+				case EventRecordType::Strike:
+					printf("%" PRIu32 ",%" PRIu64 ",strike,%" PRIu64 ",%.2f\n", record.boot, record.timestamp, record.audioTimestamp, record.distance);
+					break;
+			}
+			printed++;
+		}
+	}
+
+	fprintf(stderr, "%zu of %zu records, %zu sync points indexed, %zu torn records skipped\n",
+			printed, log.getCount(), log.getIndex().size(), log.getSkipped());
+	return 0;
+}
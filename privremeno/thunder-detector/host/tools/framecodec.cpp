@@ -0,0 +1,125 @@
+//Converts frame files (FrameFileFormat.h) between plain and coded grayscale (Util/FrameCodec.h): by default decodes
+//a frame log (CONFIG_FRAME_LOG) into plain 8-bit grayscale frames, -c codes a grayscale frame file like the
+//firmware does, with -n as the maximum pixel error and a key frame every -k frames.
+//Prints the frame count, coding ratio and the time per frame.
+//Usage: framecodec [-c [-n near] [-k interval]] in.thf out.thf
+
+#include "FrameFileSource.h"
+#include <FrameFileFormat.h>
+#include <Util/FrameCodec.h>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <chrono>
+#include <unistd.h>
+
+int main(int argc, char** argv){
+	bool encode = false;
+	int near = 0, keyInterval = 50;
+
+	int opt;
+	while((opt = getopt(argc, argv, "cn:k:")) != -1){
+		switch(opt){
+			case 'c':
+				encode = true;
+				break;
+			case 'n':
+				near = atoi(optarg);
+				break;
+			case 'k':
+				keyInterval = std::max(1, atoi(optarg));
+				break;
+			default:
+				optind = argc;
+				break;
+		}
+	}
+
+	if(argc - optind != 2 || near < 0 || near > 3){
+		fprintf(stderr, "Usage: %s [-c [-n near] [-k interval]] in.thf out.thf\n", argv[0]);
+		return 1;
+	}
+	const char* inPath = argv[optind];
+	const char* outPath = argv[optind + 1];
+
+	FrameFileSource source(inPath);
+	if(!source.isOpen()) return 1;
+
+	FILE* out = nullptr; //opened once the first frame is known to fit, nothing is left behind otherwise
+	std::unique_ptr<FrameEncoder> encoder;
+	std::vector<uint8_t> coded;
+	size_t frames = 0, plainBytes = 0, codedBytes = 0;
+	double codingTime = 0;
+
+	uint64_t timestamp;
+	while(source.peek(timestamp)){
+		camera_fb_t* frame = source.getFrame();
+		if(!frame) break;
+
+		if(frames == 0){
+			if(encode && frame->format != PIXFORMAT_GRAYSCALE){
+				fprintf(stderr, "%s: only grayscale frames can be coded\n", inPath);
+				return 1;
+			}
+
+			out = fopen(outPath, "wb");
+			if(!out){
+				perror(outPath);
+				return 1;
+			}
+
+			FrameFileHeader header{};
+			memcpy(header.magic, FrameFileMagic, 4);
+			header.version = FrameFileVersion;
+			header.format = encode ? FrameFileCoded : (uint16_t) frame->format;
+			header.width = frame->width;
+			header.height = frame->height;
+			fwrite(&header, sizeof(header), 1, out);
+
+			if(encode){
+				encoder = std::make_unique<FrameEncoder>(frame->width, frame->height, near);
+				coded.resize(encoder->maxOutput());
+			}
+		}
+
+		FrameFileEntry entry = { timestamp, (uint32_t) frame->len, 0 };
+		const uint8_t* data = frame->buf;
+
+		if(encoder){
+			const auto start = std::chrono::steady_clock::now();
+			entry.len = encoder->encode(frame->buf, frames % keyInterval == 0, coded.data());
+			codingTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			data = coded.data();
+		}
+
+		fwrite(&entry, sizeof(entry), 1, out);
+		fwrite(data, 1, entry.len, out);
+
+		frames++;
+		plainBytes += frame->len;
+		codedBytes += entry.len;
+	}
+
+	if(!out){
+		fprintf(stderr, "%s: no frames\n", inPath);
+		return 1;
+	}
+
+	const bool ok = ferror(out) == 0;
+	fclose(out);
+	if(!ok){
+		fprintf(stderr, "Error writing %s\n", outPath);
+		return 1;
+	}
+
+	fprintf(stderr, "%zu frames", frames);
+	if(encoder){
+		fprintf(stderr, ", coded %.2f:1, %.3f ms per frame", codedBytes ? (double) plainBytes / codedBytes : 0.0,
+				frames ? codingTime * 1000 / frames : 0.0);
+	}
+	fprintf(stderr, "\n");
+	return 0;
+}
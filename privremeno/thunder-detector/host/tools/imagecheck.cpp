@@ -0,0 +1,140 @@
+//Checks the Util/Image.h kernels against OpenCV outputs stored in host/data/image (written by imageref.py): resize
+//(INTER_LINEAR) and downscaleBox (INTER_AREA) within the per-pixel tolerance of each case, absdiff, threshold,
+//countNonZero and sum exactly. The inputs are generated here, the same as in imageref.py.
+//Prints the largest error of every case, then PASS or FAIL, and exits with 1 on a failure.
+//Usage: imagecheck [host/data/image]
+
+#include <Util/Image.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+static constexpr uint8_t Threshold = 20;
+
+//xorshift32, bytes are the top 8 bits of each step
+static std::vector<uint8_t> random(uint32_t seed, size_t count){
+	std::vector<uint8_t> out(count);
+	uint32_t x = seed;
+	for(auto& value : out){
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		value = x >> 24;
+	}
+	return out;
+}
+
+//'a' is noise, 'b' is 'a' with every third pixel (by the generator) replaced
+static void inputs(uint32_t width, uint32_t height, uint32_t seed, std::vector<uint8_t>& a, std::vector<uint8_t>& b){
+	const size_t count = (size_t) width * height;
+	a = random(seed, count);
+	const auto noise = random(seed ^ 0x5A5A5A5A, 2 * count);
+	b.resize(count);
+	for(size_t i = 0; i < count; i++){
+		b[i] = noise[2 * i] % 3 == 0 ? noise[2 * i + 1] : a[i];
+	}
+}
+
+static bool readPgm(const std::string& path, uint32_t width, uint32_t height, std::vector<uint8_t>& pixels){
+	FILE* file = fopen(path.c_str(), "rb");
+	if(!file){
+		fprintf(stderr, "Can't open %s\n", path.c_str());
+		return false;
+	}
+
+	uint32_t w, h, max;
+	pixels.resize((size_t) width * height);
+	const bool ok = fscanf(file, "P5 %u %u %u", &w, &h, &max) == 3 && fgetc(file) != EOF && w == width && h == height && max == 255 &&
+					fread(pixels.data(), 1, pixels.size(), file) == pixels.size();
+	fclose(file);
+
+	if(!ok){
+		fprintf(stderr, "%s: not a %ux%u 8-bit PGM\n", path.c_str(), width, height);
+	}
+	return ok;
+}
+
+static int maxError(const std::vector<uint8_t>& image, const std::vector<uint8_t>& reference){
+	int error = 0;
+	for(size_t i = 0; i < image.size(); i++){
+		error = std::max(error, abs(image[i] - reference[i]));
+	}
+	return error;
+}
+
+int main(int argc, char** argv){
+	const std::string dir = argc > 1 ? argv[1] : "host/data/image";
+
+	FILE* csv = fopen((dir + "/reference.csv").c_str(), "r");
+	if(!csv){
+		fprintf(stderr, "Can't open %s/reference.csv\nUsage: %s [host/data/image]\n", dir.c_str(), argv[0]);
+		return 1;
+	}
+
+	size_t cases = 0, failed = 0;
+	char line[256];
+	while(fgets(line, sizeof(line), csv)){
+		if(line[0] == '#') continue;
+
+		char kernel[32], reference[128];
+		uint32_t width, height, seed, outWidth, outHeight;
+		int tolerance;
+		if(sscanf(line, "%31[^,],%u,%u,%u,%u,%u,%d,%127s", kernel, &width, &height, &seed, &outWidth, &outHeight, &tolerance, reference) != 8){
+			fprintf(stderr, "Bad line: %s", line);
+			failed++;
+			continue;
+		}
+
+		std::vector<uint8_t> a, b;
+		inputs(width, height, seed, a, b);
+		std::vector<uint8_t> diff(a.size()), thresholded(a.size());
+		Image::absdiff(a.data(), b.data(), diff.data(), diff.size());
+		Image::threshold(diff.data(), thresholded.data(), thresholded.size(), Threshold, 255);
+
+		int error;
+		if(strcmp(kernel, "countNonZero") == 0){
+			error = Image::countNonZero(thresholded.data(), thresholded.size()) == strtoull(reference, nullptr, 10) ? 0 : INT32_MAX;
+		}else if(strcmp(kernel, "sum") == 0){
+			error = Image::sum(a.data(), a.size()) == strtoull(reference, nullptr, 10) ? 0 : INT32_MAX;
+		}else{
+			std::vector<uint8_t> image, expected;
+			if(strcmp(kernel, "linear") == 0 || strcmp(kernel, "area") == 0){
+				image.resize((size_t) outWidth * outHeight);
+				const ImageView src(a.data(), width, height), dst(image.data(), outWidth, outHeight);
+				if(kernel[0] == 'l'){
+					Image::resize(src, dst);
+				}else{
+					Image::downscaleBox(src, dst);
+				}
+			}else if(strcmp(kernel, "absdiff") == 0){
+				image = diff;
+			}else if(strcmp(kernel, "threshold") == 0){
+				image = thresholded;
+			}else{
+				fprintf(stderr, "Unknown kernel %s\n", kernel);
+				failed++;
+				continue;
+			}
+
+			if(!readPgm(dir + "/" + reference, outWidth, outHeight, expected)){
+				failed++;
+				continue;
+			}
+			error = maxError(image, expected);
+		}
+
+		const bool ok = error <= tolerance;
+		char size[32];
+		snprintf(size, sizeof(size), outWidth ? "%ux%u -> %ux%u" : "%ux%u", width, height, outWidth, outHeight);
+		printf("%-12s %-20s max error %s (%d allowed)\n", kernel, size, error == INT32_MAX ? "mismatch" : std::to_string(error).c_str(), tolerance);
+		cases++;
+		failed += ok ? 0 : 1;
+	}
+	fclose(csv);
+
+	printf("%zu cases, %s\n", cases, failed == 0 && cases > 0 ? "PASS" : "FAIL");
+	return failed == 0 && cases > 0 ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+# Writes the OpenCV reference outputs imagecheck compares the Util/Image.h kernels against into host/data/image.
+# Only needed again when a case is added: run with numpy and opencv-python installed, from the repository root.
+# Usage: host/tools/imageref.py [out_dir]
+
+import os
+import sys
+import numpy as np
+import cv2
+
+# kernel, width, height, seed, out width, out height, tolerance [per pixel]
+Cases = [
+	("linear", 33, 17, 1, 80, 60, 1),
+	("linear", 100, 75, 2, 80, 60, 1),
+	("linear", 160, 120, 3, 80, 60, 0),
+	("linear", 240, 180, 4, 80, 60, 0),
+	("linear", 200, 150, 5, 80, 60, 1),
+	("linear", 640, 480, 6, 160, 120, 1),
+	("area", 160, 120, 7, 80, 60, 1),
+	("area", 320, 240, 8, 80, 60, 1),
+	("absdiff", 83, 61, 9, 83, 61, 0),
+	("threshold", 83, 61, 9, 83, 61, 0),
+	("countNonZero", 83, 61, 9, 0, 0, 0),
+	("sum", 83, 61, 9, 0, 0, 0),
+]
+
+Threshold = 20
+
+
+# xorshift32, the same generator as imagecheck.cpp: bytes are the top 8 bits of each step
+def random(seed, count):
+	x = seed
+	out = np.empty(count, np.uint8)
+	for i in range(count):
+		x ^= (x << 13) & 0xFFFFFFFF
+		x ^= x >> 17
+		x ^= (x << 5) & 0xFFFFFFFF
+		out[i] = x >> 24
+	return out
+
+
+# 'a' is noise, 'b' is 'a' with every third pixel (by the generator) replaced
+def inputs(width, height, seed):
+	count = width * height
+	a = random(seed, count)
+	noise = random(seed ^ 0x5A5A5A5A, 2 * count)
+	b = np.where(noise[0::2] % 3 == 0, noise[1::2], a).astype(np.uint8)
+	return a.reshape(height, width), b.reshape(height, width)
+
+
+def writePgm(path, image):
+	with open(path, "wb") as file:
+		file.write(b"P5\n%d %d\n255\n" % (image.shape[1], image.shape[0]))
+		file.write(image.tobytes())
+
+
+def main():
+	out = sys.argv[1] if len(sys.argv) > 1 else "host/data/image"
+	os.makedirs(out, exist_ok=True)
+
+	with open(os.path.join(out, "reference.csv"), "w") as csv:
+		csv.write("#kernel,width,height,seed,outWidth,outHeight,tolerance,reference\n")
+		for kernel, width, height, seed, outWidth, outHeight, tolerance in Cases:
+			a, b = inputs(width, height, seed)
+			diff = cv2.absdiff(a, b)
+			_, thresholded = cv2.threshold(diff, Threshold, 255, cv2.THRESH_BINARY)
+
+			if kernel == "countNonZero":
+				reference = str(cv2.countNonZero(thresholded))
+			elif kernel == "sum":
+				reference = str(int(cv2.sumElems(a)[0]))
+			else:
+				if kernel == "linear":
+					image = cv2.resize(a, (outWidth, outHeight), interpolation=cv2.INTER_LINEAR)
+				elif kernel == "area":
+					image = cv2.resize(a, (outWidth, outHeight), interpolation=cv2.INTER_AREA)
+				elif kernel == "absdiff":
+					image = diff
+				else:
+					image = thresholded
+				reference = "%s_%dx%d_%dx%d.pgm" % (kernel, width, height, outWidth, outHeight)
+				writePgm(os.path.join(out, reference), image)
+
+			csv.write("%s,%d,%d,%d,%d,%d,%d,%s\n" % (kernel, width, height, seed, outWidth, outHeight, tolerance, reference))
+
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,62 @@
+//Renders a binary deferred log (/sd/log.bin, CONFIG_DEFERRED_LOG_SD) as text.
+//Usage: logdecode <log.bin>
+
+#include <Util/LogFormat.h>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+int main(int argc, char** argv){
+	if(argc < 2){
+		fprintf(stderr, "Usage: %s <log.bin>\n", argv[0]);
+		return 1;
+	}
+
+	FILE* in = fopen(argv[1], "rb");
+	if(!in){
+		perror(argv[1]);
+		return 1;
+	}
+
+	LogHeader header{};
+	if(fread(&header, sizeof(header), 1, in) != 1 || memcmp(header.magic, LogHeaderDefault.magic, 4) != 0){
+		fprintf(stderr, "%s: not a deferred log\n", argv[1]);
+		return 1;
+	}
+	if(header.version != LogHeaderDefault.version || header.recordSize != sizeof(LogRecord)){
+		fprintf(stderr, "%s: unsupported log version %u (record size %u)\n", argv[1], header.version, header.recordSize);
+		return 1;
+	}
+
+	static constexpr char LevelChars[] = "NEWIDV";
+	std::unordered_map<uint64_t, std::string> strings;
+	char text[1024];
+	size_t messages = 0, unresolved = 0;
+
+	auto lookup = [&](uint64_t id) -> const char*{
+		auto it = strings.find(id);
+		if(it != strings.end()) return it->second.c_str();
+		unresolved++;
+		return "(?)";
+	};
+
+	LogRecord rec;
+	while(fread(&rec, sizeof(rec), 1, in) == 1){
+		if(rec.kind == LogRecord::String){
+			std::string str(rec.words[0], '\0');
+			if(fread(str.data(), 1, str.size(), in) != str.size()) break;
+			strings[rec.fmt] = std::move(str);
+			continue;
+		}
+
+		const auto count = std::min<size_t>(rec.count, LogMaxWords);
+		formatLog(text, sizeof(text), lookup(rec.fmt), rec.words, count, header.pointerSize, lookup);
+
+		printf("%c (%llu) %s: %s\n", LevelChars[std::min<uint8_t>(rec.level, 5)], (unsigned long long) rec.timestamp / 1000, lookup(rec.tag), text);
+		messages++;
+	}
+	fclose(in);
+
+	fprintf(stderr, "%zu messages, %zu unresolved strings\n", messages, unresolved);
+	return 0;
+}
@@ -0,0 +1,129 @@
+//Runs recorded audio and/or frames through the detectors and fusion, faster than real time.
+//With -e, runs the detections of an event log (CONFIG_EVENT_LOG) through fusion alone instead, optionally
+//only one boot from a time on.
+//Usage: replay [-v] [-b buffer_samples] [-a audio.wav] [-f frames.thf]
+//       replay [-v] -e events.bin [-B boot] [-s from_ms] [-t to_ms]
+
+#include "Replay.h"
+#include "WavSource.h"
+#include "FrameFileSource.h"
+#include "EventLogReader.h"
+#include <esp_log.h>
+#include <chrono>
+#include <memory>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+int main(int argc, char** argv){
+	const char* audioPath = nullptr;
+	const char* framesPath = nullptr;
+	const char* eventsPath = nullptr;
+	size_t buffer = 16000;
+	bool verbose = false;
+	bool range = false;
+	uint32_t boot = 0;
+	uint64_t from = 0, to = UINT64_MAX;
+
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "-v") == 0){
+			verbose = true;
+		}else if(strcmp(argv[i], "-a") == 0 && i + 1 < argc){
+			audioPath = argv[++i];
+		}else if(strcmp(argv[i], "-f") == 0 && i + 1 < argc){
+			framesPath = argv[++i];
+		}else if(strcmp(argv[i], "-b") == 0 && i + 1 < argc && strtoul(argv[i + 1], nullptr, 10) > 0){
+			buffer = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-e") == 0 && i + 1 < argc){
+			eventsPath = argv[++i];
+		}else if(strcmp(argv[i], "-B") == 0 && i + 1 < argc){
+			boot = strtoul(argv[++i], nullptr, 10);
+			range = true;
+		}else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc){
+			from = strtoull(argv[++i], nullptr, 10);
+			range = true;
+		}else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc){
+			to = strtoull(argv[++i], nullptr, 10);
+			range = true;
+		}else{
+			fprintf(stderr, "Usage: %s [-v] [-b buffer_samples] [-a audio.wav] [-f frames.thf]\n"
+							"       %s [-v] -e events.bin [-B boot] [-s from_ms] [-t to_ms]\n", argv[0], argv[0]);
+			return 1;
+		}
+	}
+
+	if(eventsPath){
+		esp_log_level_set("*", verbose ? ESP_LOG_INFO : ESP_LOG_WARN);
+
+		EventLogReader log(eventsPath);
+		if(!log.isOpen()) return 1;
+
+		//timestamps restart at every boot, so every boot is fused on its own
+		std::vector<std::pair<uint32_t, std::vector<SensorEvent>>> boots;
+		if(!range || log.seek(boot, from)){
+			EventRecord record;
+			while(log.next(record)){
+				if(range){
+					//records reach the log out of order until the next Sync, so only a Sync past 'to' or the next boot ends the range
+					if(record.boot != boot || (record.type == EventRecordType::Sync && record.timestamp > to)) break;
+					if(record.timestamp < from || record.timestamp > to) continue;
+				}
+
+				if(boots.empty() || boots.back().first != record.boot){
+					boots.emplace_back(record.boot, std::vector<SensorEvent>());
+				}
+
+				SensorEvent event;
+				if(EventLogReader::toEvent(record, event)){
+					boots.back().second.push_back(event);
+				}
+			}
+		}
+
+		size_t events = 0, strikes = 0;
+		for(const auto& [number, bootEvents] : boots){
+			const auto result = Replay::fuse(bootEvents);
+			printf("# boot %u\n", number);
+			Replay::write(stdout, result);
+			events += result.events.size();
+			strikes += result.strikes.size();
+		}
+
+		fprintf(stderr, "%zu boots, %zu events, %zu strikes, %zu torn records skipped\n", boots.size(), events, strikes, log.getSkipped());
+		return 0;
+	}
+
+	if(!audioPath && !framesPath){
+		fprintf(stderr, "Nothing to replay, give -a and/or -f\n");
+		return 1;
+	}
+
+	esp_log_level_set("*", verbose ? ESP_LOG_INFO : ESP_LOG_WARN);
+
+	std::unique_ptr<WavSource> audio;
+	if(audioPath){
+		audio = std::make_unique<WavSource>(audioPath);
+		if(!audio->isOpen()) return 1;
+	}
+
+	std::unique_ptr<FrameFileSource> frames;
+	if(framesPath){
+		frames = std::make_unique<FrameFileSource>(framesPath);
+		if(!frames->isOpen()) return 1;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	Replay replay(audio.get(), frames.get(), buffer);
+	const auto result = replay.run();
+
+	const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	const double replayed = result.duration / 1e6;
+
+	Replay::write(stdout, result);
+	fprintf(stderr, "replayed %.1f s in %.3f s (%.0fx real time), %zu events, %zu strikes\n",
+			replayed, wall, wall > 0 ? replayed / wall : 0.0, result.events.size(), result.strikes.size());
+
+	return 0;
+}
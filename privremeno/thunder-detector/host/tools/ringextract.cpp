@@ -0,0 +1,198 @@
+//Extracts the raw sector ring (CONFIG_RING_LOG) into files, oldest record first: frames as
+//<boot>_<ms>_<sequence>.pgm, audio blocks as <boot>_<ms>_<sequence>.wav and events into events.csv as
+//"<boot>,<ms>,video,<intensity>", "<boot>,<ms>,audio,<type>", "<boot>,<ms>,strike,<audio ms>,<distance m>".
+//The input is the whole card (the ring is found in its MBR), the ring partition, or an image of either.
+//Usage: ringextract /dev/sdX|card.img out_dir
+
+#include "RingLogFormat.h"
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+static constexpr const char* ThunderNames[] = { "clap", "peal", "rumble" };
+
+static FILE* input = nullptr;
+static uint64_t partitionStart = 0; //[sectors]
+
+static bool readSectors(uint64_t sector, void* data, size_t count){
+	return fseeko(input, (off_t) ((partitionStart + sector) * RingSectorSize), SEEK_SET) == 0 &&
+		   fread(data, RingSectorSize, count, input) == count;
+}
+
+static bool findRing(RingSuperblock& superblock){
+	uint8_t sector[RingSectorSize];
+	if(!readSectors(0, sector, 1)) return false;
+
+	//whole card: look for the ring partition in the MBR
+	if(memcmp(sector, RingSuperblockMagic, 4) != 0 && sector[510] == 0x55 && sector[511] == 0xAA){
+		for(int i = 0; i < 4; i++){
+			const uint8_t* entry = sector + 446 + i * 16;
+			if(entry[4] != RingPartitionType) continue;
+
+			uint32_t start;
+			memcpy(&start, entry + 8, 4);
+			partitionStart = start;
+			break;
+		}
+		if(!readSectors(0, sector, 1)) return false;
+	}
+
+	memcpy(&superblock, sector, sizeof(superblock));
+	return memcmp(superblock.magic, RingSuperblockMagic, 4) == 0 && superblock.version == RingVersion &&
+		   superblock.sectorSize == RingSectorSize && superblock.crc == ringCrc32(&superblock, offsetof(RingSuperblock, crc));
+}
+
+struct Record {
+	RingRecordHeader header;
+	uint64_t sector; //in the data area
+};
+
+static bool readRecord(uint64_t sector, const RingRecordHeader& header, std::vector<uint8_t>& payload){
+	std::vector<uint8_t> data(ringSectors(header.size) * RingSectorSize);
+	if(!readSectors(RingDataStart + sector, data.data(), data.size() / RingSectorSize)) return false;
+
+	payload.assign(data.begin() + sizeof(RingRecordHeader), data.begin() + sizeof(RingRecordHeader) + header.size);
+	return ringCrc32(payload.data(), payload.size()) == header.payloadCrc;
+}
+
+static void writePgm(const std::string& path, const RingRecordHeader& header, const std::vector<uint8_t>& pixels){
+	FILE* file = fopen(path.c_str(), "wb");
+	if(!file) return;
+	fprintf(file, "P5\n%u %u\n255\n", header.width, header.height);
+	fwrite(pixels.data(), 1, pixels.size(), file);
+	fclose(file);
+}
+
+static void writeWav(const std::string& path, const RingRecordHeader& header, const std::vector<uint8_t>& samples){
+	FILE* file = fopen(path.c_str(), "wb");
+	if(!file) return;
+
+	const uint32_t rate = header.sampleRate, byteRate = rate * 2, fmtSize = 16;
+	const uint32_t dataSize = samples.size(), riffSize = 36 + dataSize;
+	const uint16_t format = 1, channels = 1, blockAlign = 2, bits = 16;
+
+	fwrite("RIFF", 1, 4, file);
+	fwrite(&riffSize, 4, 1, file);
+	fwrite("WAVEfmt ", 1, 8, file);
+	fwrite(&fmtSize, 4, 1, file);
+	fwrite(&format, 2, 1, file);
+	fwrite(&channels, 2, 1, file);
+	fwrite(&rate, 4, 1, file);
+	fwrite(&byteRate, 4, 1, file);
+	fwrite(&blockAlign, 2, 1, file);
+	fwrite(&bits, 2, 1, file);
+	fwrite("data", 1, 4, file);
+	fwrite(&dataSize, 4, 1, file);
+	fwrite(samples.data(), 1, samples.size(), file);
+	fclose(file);
+}
+
+int main(int argc, char** argv){
+	if(argc != 3){
+		fprintf(stderr, "Usage: %s /dev/sdX|card.img out_dir\n", argv[0]);
+		return 1;
+	}
+
+	input = fopen(argv[1], "rb");
+	if(!input){
+		fprintf(stderr, "Can't open %s\n", argv[1]);
+		return 1;
+	}
+
+	RingSuperblock superblock;
+	if(!findRing(superblock)){
+		fprintf(stderr, "%s: no ring superblock\n", argv[1]);
+		return 1;
+	}
+
+	//every intact record in the data area, wherever the head is - records partly overwritten by a later lap
+	//or torn by a power loss fail the CRC and are skipped
+	std::vector<Record> records;
+	size_t torn = 0;
+	std::vector<uint8_t> payload;
+	uint8_t sector[RingSectorSize];
+
+	for(uint64_t s = 0; s < superblock.dataSectors;){
+		RingRecordHeader header;
+		if(!readSectors(RingDataStart + s, sector, 1)) break;
+		memcpy(&header, sector, sizeof(header));
+
+		const bool valid = memcmp(header.magic, RingRecordMagic, 4) == 0 && header.ringId == superblock.ringId &&
+						   header.headerCrc == ringCrc32(&header, offsetof(RingRecordHeader, headerCrc)) &&
+						   s + ringSectors(header.size) <= superblock.dataSectors;
+		if(!valid){
+			s++;
+			continue;
+		}
+
+		if(readRecord(s, header, payload)){
+			records.push_back({ header, s });
+			s += ringSectors(header.size);
+		}else{
+			torn++;
+			s++;
+		}
+	}
+
+	std::sort(records.begin(), records.end(), [](const Record& a, const Record& b){
+		return a.header.sequence < b.header.sequence;
+	});
+
+	fs::create_directories(argv[2]);
+	const fs::path out = argv[2];
+
+	FILE* events = fopen((out / "events.csv").c_str(), "w");
+	if(!events){
+		fprintf(stderr, "Can't write %s\n", (out / "events.csv").c_str());
+		return 1;
+	}
+
+	size_t frames = 0, audio = 0, eventCount = 0;
+	for(const auto& record : records){
+		const auto& header = record.header;
+		if(!readRecord(record.sector, header, payload)) continue;
+
+		const std::string name = std::to_string(header.boot) + "_" + std::to_string(header.timestamp) + "_" + std::to_string(header.sequence);
+
+		if(header.type == RingRecordType::Frame && payload.size() == (size_t) header.width * header.height){
+			writePgm((out / (name + ".pgm")).string(), header, payload);
+			frames++;
+
+		}else if(header.type == RingRecordType::Audio){
+			writeWav((out / (name + ".wav")).string(), header, payload);
+			audio++;
+
+		}else if(header.type == RingRecordType::Event && payload.size() == sizeof(RingEvent)){
+			RingEvent event;
+			memcpy(&event, payload.data(), sizeof(event));
+
+			if(event.type == RingEventType::Video){
+				fprintf(events, "%" PRIu32 ",%" PRIu64 ",video,%u\n", header.boot, header.timestamp, event.value);
+			}else if(event.type == RingEventType::Audio){
+				fprintf(events, "%" PRIu32 ",%" PRIu64 ",audio,%s\n", header.boot, header.timestamp, event.value < 3 ? ThunderNames[event.value] : "?");
+			}else{
+				fprintf(events, "%" PRIu32 ",%" PRIu64 ",strike,%" PRIu64 ",%.2f\n", header.boot, header.timestamp, event.audioTimestamp, event.distance);
+			}
+			eventCount++;
+		}
+	}
+	fclose(events);
+
+	fprintf(stderr, "ring %08" PRIx32 ", %" PRIu32 " sectors: %zu records (%zu frames, %zu audio, %zu events), %zu torn",
+			superblock.ringId, superblock.dataSectors, records.size(), frames, audio, eventCount, torn);
+	if(!records.empty()){
+		fprintf(stderr, ", sequence %" PRIu64 "-%" PRIu64, records.front().header.sequence, records.back().header.sequence);
+	}
+	fprintf(stderr, "\n");
+
+	fclose(input);
+	return 0;
+}
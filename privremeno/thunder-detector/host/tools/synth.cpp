@@ -0,0 +1,134 @@
+//Generates synthetic thunderstorm sessions with exact ground truth (see Scenario.h). By default they are
+//streamed straight into the detectors without touching the disk and scored, one CSV line per session and
+//a total. With -o they are written as session directories instead, for replay and batch.
+//Usage: synth [-s first_seed] [-c count] [-j threads] [-d duration_s] [-n strikes] [-w wind] [-r rain]
+//             [-b buffer_samples] [-t tolerance_ms] [-o out_dir]
+
+#include "Scenario.h"
+#include "SyntheticAudio.h"
+#include "SyntheticFrames.h"
+#include "SessionWriter.h"
+#include "Replay.h"
+#include "Evaluation.h"
+#include "ThreadPool.h"
+#include <esp_log.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <atomic>
+#include <cstring>
+#include <cstdlib>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv){
+	Scenario::Config config;
+	uint32_t count = 1;
+	size_t threads = 0;
+	size_t buffer = 16000;
+	size_t tolerance = 250;
+	const char* outDir = nullptr;
+
+	for(int i = 1; i < argc; i++){
+		const bool value = i + 1 < argc;
+		if(strcmp(argv[i], "-s") == 0 && value){
+			config.seed = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-c") == 0 && value){
+			count = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-j") == 0 && value){
+			threads = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-d") == 0 && value){
+			config.duration = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-n") == 0 && value){
+			config.strikes = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-w") == 0 && value){
+			config.wind = strtof(argv[++i], nullptr);
+		}else if(strcmp(argv[i], "-r") == 0 && value){
+			config.rain = strtof(argv[++i], nullptr);
+		}else if(strcmp(argv[i], "-b") == 0 && value && strtoul(argv[i + 1], nullptr, 10) > 0){
+			buffer = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-t") == 0 && value){
+			tolerance = strtoul(argv[++i], nullptr, 10);
+		}else if(strcmp(argv[i], "-o") == 0 && value){
+			outDir = argv[++i];
+		}else{
+			fprintf(stderr, "Usage: %s [-s first_seed] [-c count] [-j threads] [-d duration_s] [-n strikes] [-w wind] [-r rain] "
+							"[-b buffer_samples] [-t tolerance_ms] [-o out_dir]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	esp_log_level_set("*", ESP_LOG_WARN);
+
+	std::vector<Evaluation> scores(count);
+	std::vector<uint64_t> durations(count);
+	std::atomic<bool> failed = false;
+
+	const auto start = std::chrono::steady_clock::now();
+	{
+		ThreadPool pool(threads);
+
+		for(uint32_t n = 0; n < count; n++){
+			pool.submit([&, n](){
+				auto sessionConfig = config;
+				sessionConfig.seed = config.seed + n;
+				const Scenario scenario(sessionConfig);
+
+				SyntheticAudio audio(scenario);
+				SyntheticFrames frames(scenario);
+
+				if(outDir){
+					const auto dir = fs::path(outDir) / ("synth" + std::to_string(sessionConfig.seed));
+					fs::create_directories(dir);
+
+					FILE* truth = fopen((dir / "truth.csv").c_str(), "w");
+					if(truth == nullptr){
+						failed = true;
+						return;
+					}
+					scenario.writeTruth(truth);
+					fclose(truth);
+
+					if(!SessionWriter::writeWav((dir / "audio.wav").c_str(), audio) ||
+					   !SessionWriter::writeFrames((dir / "frames.thf").c_str(), frames)){
+						failed = true;
+					}
+					return;
+				}
+
+				Replay replay(&audio, &frames, buffer);
+				const auto result = replay.run();
+				durations[n] = result.duration;
+				scores[n] = Evaluation::evaluate(result, scenario.getTruth(), tolerance);
+			});
+		}
+
+		pool.wait();
+	}
+
+	if(outDir){
+		fprintf(stderr, "wrote %u sessions to %s\n", count, outDir);
+		return failed ? 1 : 0;
+	}
+
+	const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	printf("seed,");
+	Evaluation::writeHeader(stdout);
+
+	Evaluation total;
+	uint64_t replayed = 0;
+	for(uint32_t n = 0; n < count; n++){
+		printf("%u,", config.seed + n);
+		scores[n].write(stdout);
+		total.add(scores[n]);
+		replayed += durations[n];
+	}
+	printf("total,");
+	total.write(stdout);
+
+	fprintf(stderr, "replayed %.1f s in %.3f s (%.0fx real time)\n", replayed / 1e6, wall, wall > 0 ? replayed / 1e6 / wall : 0.0);
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,122 @@
+//Converts a binary trace dump (/sd/trace.bin or a UART capture) into Chrome/Perfetto trace JSON.
+//Usage: trace2json <trace.bin> [out.json]
+
+#include <Util/TraceFormat.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+int main(int argc, char** argv){
+	if(argc < 2){
+		fprintf(stderr, "Usage: %s <trace.bin> [out.json]\n", argv[0]);
+		return 1;
+	}
+
+	FILE* in = fopen(argv[1], "rb");
+	if(!in){
+		perror(argv[1]);
+		return 1;
+	}
+
+	TraceHeader header{};
+	if(fread(&header, sizeof(header), 1, in) != 1 || memcmp(header.magic, TraceHeaderDefault.magic, 4) != 0){
+		fprintf(stderr, "%s: not a trace dump\n", argv[1]);
+		return 1;
+	}
+	if(header.version != TraceHeaderDefault.version || header.recordSize != sizeof(TraceRecord)){
+		fprintf(stderr, "%s: unsupported trace version %u (record size %u)\n", argv[1], header.version, header.recordSize);
+		return 1;
+	}
+
+	std::vector<TraceRecord> records;
+	TraceRecord record;
+	while(fread(&record, sizeof(record), 1, in) == 1){
+		records.push_back(record);
+	}
+	fclose(in);
+
+	//per-core chunks are flushed one after another, restore global time order
+	std::stable_sort(records.begin(), records.end(), [](const TraceRecord& a, const TraceRecord& b){
+		return a.timestamp < b.timestamp;
+	});
+
+	FILE* out = argc > 2 ? fopen(argv[2], "w") : stdout;
+	if(!out){
+		perror(argv[2]);
+		return 1;
+	}
+
+	const uint64_t origin = records.empty() ? 0 : records.front().timestamp;
+	auto name = [](TraceId id){
+		return (size_t) id < (size_t) TraceId::Count ? TraceNames[(size_t) id] : "Unknown";
+	};
+
+	fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+	auto sep = [&](){
+		if(!first) fprintf(out, ",\n");
+		first = false;
+	};
+
+	uint8_t cores = 0;
+	for(const auto& r : records){
+		cores = std::max<uint8_t>(cores, r.core + 1);
+	}
+	for(uint8_t core = 0; core < cores; core++){
+		sep();
+		fprintf(out, R"({"name":"thread_name","ph":"M","pid":0,"tid":%u,"args":{"name":"core %u"}})", core, core);
+	}
+
+	//spans of the same id never nest on one core, so one open begin per (core, id) is enough
+	std::map<std::pair<uint8_t, uint16_t>, TraceRecord> open;
+	size_t unmatched = 0;
+
+	for(const auto& r : records){
+		const auto ts = r.timestamp - origin;
+		const auto key = std::make_pair(r.core, (uint16_t) r.id);
+
+		switch(r.type){
+			case TraceType::Begin:
+				if(open.count(key)) unmatched++;
+				open[key] = r;
+				break;
+
+			case TraceType::End:{
+				auto it = open.find(key);
+				if(it == open.end()){
+					unmatched++;
+					break;
+				}
+				const auto& begin = it->second;
+				sep();
+				fprintf(out, R"({"name":"%s","ph":"X","pid":0,"tid":%u,"ts":%llu,"dur":%llu,"args":{"begin":%u,"end":%u}})",
+						name(r.id), r.core, (unsigned long long) (begin.timestamp - origin),
+						(unsigned long long) (r.timestamp - begin.timestamp), begin.arg, r.arg);
+				open.erase(it);
+				break;
+			}
+
+			case TraceType::Instant:
+				sep();
+				fprintf(out, R"({"name":"%s","ph":"i","s":"t","pid":0,"tid":%u,"ts":%llu,"args":{"arg":%u}})",
+						name(r.id), r.core, (unsigned long long) ts, r.arg);
+				break;
+
+			case TraceType::Counter:
+				sep();
+				fprintf(out, R"({"name":"%s","ph":"C","pid":0,"tid":%u,"ts":%llu,"args":{"value":%u}})",
+						name(r.id), r.core, (unsigned long long) ts, r.arg);
+				break;
+		}
+	}
+
+	fprintf(out, "\n]}\n");
+	if(out != stdout) fclose(out);
+
+	unmatched += open.size();
+	fprintf(stderr, "%zu records, %zu unmatched span events\n", records.size(), unmatched);
+
+	return 0;
+}
@@ -0,0 +1,78 @@
+//Converts recordings between the AudioCodec formats (Util/AudioCodec.h): by default decodes an IMA ADPCM or
+//lossless recording to 16-bit PCM for tools that don't read them, -a and -l code any input as IMA ADPCM or lossless.
+//Prints the duration, coding ratio and the time taken.
+//Usage: wavcodec [-a|-l] in.wav out.wav
+
+#include "WavSource.h"
+#include <Util/AudioCodec.h>
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+#include <vector>
+#include <chrono>
+
+int main(int argc, char** argv){
+	AudioCodec codec = AudioCodec::Pcm;
+	int arg = 1;
+	if(argc > 1 && strcmp(argv[1], "-a") == 0){
+		codec = AudioCodec::ImaAdpcm;
+		arg++;
+	}else if(argc > 1 && strcmp(argv[1], "-l") == 0){
+		codec = AudioCodec::Lossless;
+		arg++;
+	}
+
+	if(argc - arg != 2){
+		fprintf(stderr, "Usage: %s [-a|-l] in.wav out.wav\n", argv[0]);
+		return 1;
+	}
+
+	WavSource source(argv[arg]);
+	if(!source.isOpen()) return 1;
+
+	FILE* out = fopen(argv[arg + 1], "wb");
+	if(!out){
+		perror(argv[arg + 1]);
+		return 1;
+	}
+
+	AudioEncoder encoder(codec);
+	std::vector<uint8_t> header(encoder.headerSize());
+	fwrite(header.data(), 1, header.size(), out); //patched at the end
+
+	const auto start = std::chrono::steady_clock::now();
+
+	std::vector<int16_t> samples(source.getSampleRate());
+	std::vector<uint8_t> coded(encoder.maxOutput(samples.size()));
+	uint64_t count = 0, dataSize = 0;
+
+	while(!source.finished()){
+		const size_t n = source.read(samples.data(), samples.size());
+		if(n == 0) break;
+
+		const size_t size = encoder.encode(samples.data(), n, coded.data());
+		fwrite(coded.data(), 1, size, out);
+		count += n;
+		dataSize += size;
+	}
+	const size_t size = encoder.flush(coded.data());
+	fwrite(coded.data(), 1, size, out);
+	dataSize += size;
+
+	const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	encoder.header(header.data(), source.getSampleRate(), count, dataSize);
+	fseek(out, 0, SEEK_SET);
+	fwrite(header.data(), 1, header.size(), out);
+
+	const bool ok = ferror(out) == 0;
+	fclose(out);
+	if(!ok){
+		fprintf(stderr, "Error writing %s\n", argv[arg + 1]);
+		return 1;
+	}
+
+	fprintf(stderr, "%.1f s of audio, %" PRIu64 " B of data, %.2f:1 to PCM, %.3f s\n", (double) count / source.getSampleRate(),
+			dataSize, dataSize > 0 ? (double) count * sizeof(int16_t) / dataSize : 0.0, elapsed);
+	return 0;
+}
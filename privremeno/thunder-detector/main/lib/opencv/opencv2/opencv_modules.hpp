@@ -1,16 +0,0 @@
-/*
- *      ** File generated automatically, do not modify **
- *
- * This file defines the list of modules available in current build configuration
- *
- *
-*/
-
-// This definition means that OpenCV is built with enabled non-free code.
-// For example, patented algorithms for non-profit/non-commercial use only.
-/* #undef OPENCV_ENABLE_NONFREE */
-
-#define HAVE_OPENCV_CORE
-#define HAVE_OPENCV_IMGPROC
-
-
@@ -6,8 +6,30 @@
 #include "Devices/Camera.h"
 #include "VisualDetector.h"
 #include "Periph/SD.h"
+#include "Util/Instrumentation.h"
+#include "Util/Memory.h"
+#include "Util/Trace.h"
+#include "Util/DeferredLog.h"
+#include "Util/Timer.h"
+#include "Devices/Mic.h"
+#include "Fusion.h"
+#include "EventLog.h"
+#include "RingLog.h"
+#include "FrameLog.h"
+
+#if defined(CONFIG_VIDEO_JPEG_DC_SXGA)
+static constexpr framesize_t JpegFrameSize = FRAMESIZE_SXGA;
+#elif defined(CONFIG_VIDEO_JPEG_DC_XGA)
+static constexpr framesize_t JpegFrameSize = FRAMESIZE_XGA;
+#elif defined(CONFIG_VIDEO_JPEG_DC_SVGA)
+static constexpr framesize_t JpegFrameSize = FRAMESIZE_SVGA;
+#else
+static constexpr framesize_t JpegFrameSize = FRAMESIZE_VGA;
+#endif
 
 void init(){
+	calibrateCycles();
+
 	esp_log_level_set("*", ESP_LOG_INFO);
 //	esp_log_level_set("AudioDetect", ESP_LOG_DEBUG);
 //	esp_log_level_set("VideoDetect", ESP_LOG_DEBUG);
@@ -18,62 +40,58 @@ void init(){
 		return;
 	}
 
+	Trace::start();
+	DeferredLog::start();
+	EventLog::start();
+	RingLog::start(SD::getCard());
+	FrameLog::start(VisualDetector::FrameWidth, VisualDetector::FrameHeight);
+
 	auto i2c = new I2C(I2C_NUM_0, (gpio_num_t) I2C_CAM_SDA, (gpio_num_t) I2C_CAM_SCL);
 	auto camera = new Camera(*i2c);
 
+#ifdef CONFIG_VIDEO_JPEG_DC
+	//VisualDetector reads the luminance from the DC coefficients
+	camera->setFormat(PIXFORMAT_JPEG);
+	camera->setRes(JpegFrameSize);
+#endif
+
 	if(camera->init() != ESP_OK){
 		printf("Cam init error\n");
 	}
 
-	Queue<SensorEvent> queue(16);
+	Queue<SensorEvent> queue(16, "Events");
 
-	auto audio = new AudioDetector(16000, 16000, &queue);
+	auto mic = new Mic(16000, (gpio_num_t) PDM_CLK, (gpio_num_t) PDM_DATA);
+	auto audio = new AudioDetector(mic, 16000, &queue);
 	audio->start();
 
 	auto video = new VisualDetector(camera, &queue);
+#ifdef CONFIG_VIDEO_BURST
+	video->setBurst(CONFIG_VIDEO_IDLE_DIVIDER, CONFIG_VIDEO_BURST_MS);
+#endif
+#ifdef CONFIG_VIDEO_CALIBRATION
+	VisualDetector::Params params = video->getParams();
+	params.calibrate = true;
+	video->setParams(params);
+#endif
 	video->start();
 
+	Instrumentation::start();
+	Memory::report();
 
-	bool recognizedVideo = false;
-	SensorEvent storedVideo{};
-	static constexpr size_t AudioDelayCutoff = 60000; //60 seconds shouldn't be audible/visible
-	static constexpr int V_sound = 343; //[m/s], speed of sound constant
+	Fusion fusion;
 
 	while(1){
 		SensorEvent event{};
 		if(queue.get(event, portMAX_DELAY)){
-
-			if(event.type == SensorEvent::Type::Audio){
-
-				auto audioEvent = event.audio;
-				if(audioEvent.type == ThunderType::Clap){
-					printf("Clap at %d ms!\n", event.timestamp);
-
-					if(!recognizedVideo){
-						printf("Clap ignored, no preceding video event\n");
-						continue;
-					}
-
-
-					const int timeDiff = event.timestamp - storedVideo.timestamp;
-					if(timeDiff > AudioDelayCutoff){
-						printf("Clap ignored, too much time passed since video event\n");
-					}else{
-						const float distance = timeDiff * V_sound / 1000.0f; //distance in meters
-						printf("Possible thunderstrike detected, distance: %.2f m, timestamp: %d\n", distance, storedVideo.timestamp);
-					}
-
-					recognizedVideo = false;
-				}
-			}else if(event.type == SensorEvent::Type::Video){
-
-				auto videoEvent = event.video;
-				if(videoEvent.intensity > 0){
-					printf("Video change at %d ms! Waiting for a thunder follow-up...\n", event.timestamp);
-					recognizedVideo = true;
-					storedVideo = event;
-				}
-
+			Trace::instant(TraceId::QueueGet, (uint32_t) event.type);
+			EventLog::event(event);
+			RingLog::event(event);
+
+			Fusion::Strike strike;
+			if(fusion.process(event, strike)){
+				EventLog::strike(strike);
+				RingLog::strike(strike);
 			}
 		}
 	}
@@ -4,7 +4,8 @@
 #include "Util/Threaded.h"
 #include "Util/Queue.h"
 #include "SensorEvent.hpp"
-#include <driver/i2s_pdm.h>
+#include "Devices/AudioSource.h"
+#include "Util/Memory.h"
 
 
 
@@ -12,35 +13,42 @@ class AudioDetector : public Threaded {
 public:
 	/**
 	 * Constructs an Audio thread. Reports detected thunder patterns to queue.
+	 * @param source audio input, sample rate is taken from it
 	 * @param bufferSize number of samples in a buffer
-	 * @param sampleRate number of samples per second
 	 * @param queue optional, output queue for receiving results
 	 */
-	AudioDetector(size_t bufferSize, uint16_t sampleRate, Queue<SensorEvent>* queue = nullptr);
+	AudioDetector(AudioSource* source, size_t bufferSize, Queue<SensorEvent>* queue = nullptr);
+
+	//Clap detection thresholds, tunable offline with the host batch replay
+	struct Params {
+		int16_t clapSpikeThreshold = 2000; //initial clap must be this amplitude above the current filtered average
+		int16_t clapDecayThreshold = 750; //silence after clap must be this amplitude below the filtered average
+		size_t clapDecayTimeout = 50; //[ms] decay must be achieved quickly, otherwise not a clap
+	};
+
+	void setParams(const Params& params);
+	const Params& getParams() const;
 
 private:
 	void loop() override;
-	int i2s_init(uint32_t sampling_rate);
 
-	void detectClap(size_t startTime);
+	//@return true if a clap was detected in the block
+	bool detectClap(uint64_t startTime, size_t count);
 	void detectPeal();
 	void detectRumble();
 
-	const uint16_t sampleRate;
+	AudioSource* source;
+	const uint32_t sampleRate;
 	const size_t bufferSize;
 
-	i2s_chan_handle_t rx_chan;
-
-	int16_t* buffer = nullptr;
+	RegionBuffer<int16_t> buffer; //every sample is read several times, kept in internal RAM
 
 	Queue<SensorEvent>* outputQueue = nullptr;
 
 
 	//Clap detection
 	static constexpr float EMAFactor = 0.02; //for low-pass filter determining the ambient noise value
-	static constexpr int16_t ClapSpikeThreshold = 2000; //initial clap must be this amplitude above the current filtered average
-	static constexpr int16_t ClapDecayThreshold = 750; //silence after clap must be this amplitude below the filtered average
-	static constexpr size_t ClapDecayTimeout = 50; //[ms] decay must be achieved quickly, otherwise not a clap
+	Params params;
 
 	int16_t currentValue = 0; //current filtered value
 	bool calibrationSample = true; //first sample is without detection, just to give EMA time to stabilize
@@ -49,12 +57,12 @@ private:
 	} clapState = None;
 
 	size_t prevDecayDiff = 0;
-	size_t spikeTimestamp = 0; //[ms] timestamp of last found spike, invalid if state is None
+	uint64_t spikeTimestamp = 0; //[us] timestamp of last found spike, invalid if state is None
 
 
-	//Converts duration of 'numSamples' to milliseconds
-	constexpr size_t samplesToMs(size_t numSamples) const{
-		return numSamples * 1000 / sampleRate;
+	//Converts duration of 'numSamples' to microseconds
+	constexpr uint64_t samplesToMicros(size_t numSamples) const{
+		return (uint64_t) numSamples * 1000000 / sampleRate;
 	}
 };
 
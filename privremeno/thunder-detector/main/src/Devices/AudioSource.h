@@ -0,0 +1,24 @@
+#ifndef THUNDER_DETECTOR_AUDIOSOURCE_H
+#define THUNDER_DETECTOR_AUDIOSOURCE_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Source of 16-bit mono audio samples for AudioDetector - the microphone on the device, WAV files on host.
+ */
+class AudioSource {
+public:
+	virtual ~AudioSource() = default;
+
+	/**
+	 * Blocks until 'count' samples are read.
+	 * @return number of samples read, less than 'count' on error or end of stream
+	 */
+	virtual size_t read(int16_t* buffer, size_t count) = 0;
+
+	virtual uint32_t getSampleRate() const = 0;
+};
+
+
+#endif //THUNDER_DETECTOR_AUDIOSOURCE_H
@@ -1,6 +1,9 @@
 #include "Camera.h"
 #include <Pins.hpp>
 #include <esp_log.h>
+#include "Util/Timer.h"
+#include "Util/Trace.h"
+#include <cinttypes>
 
 static const char* TAG = "Camera";
 
@@ -102,6 +105,8 @@ esp_err_t Camera::init(){
 
 	inited = true;
 	failedFrames = 0;
+	frameDivider = 1;
+	switchPending = false;
 
 	return ESP_OK;
 }
@@ -128,6 +133,7 @@ camera_fb_t* Camera::getFrame(){
 	if(frame) return nullptr;
 
 	frame = esp_camera_fb_get();
+	frameTaken = micros();
 
 	if(frame == nullptr){
 		failedFrames++;
@@ -139,9 +145,110 @@ camera_fb_t* Camera::getFrame(){
 		failedFrames = 0;
 	}
 
+	//frames started before the registers were written can still be waiting in the buffers
+	if(frame && switchPending){
+		const uint64_t time = frameTime(frame);
+		if(time >= switchWritten){
+			switchPending = false;
+			ESP_LOGI(TAG, "frame divider %u: registers written in %" PRIu64 " us, first frame after %" PRIu64 " us",
+					 frameDivider, switchWritten - switchStart, time - switchStart);
+		}
+	}
+
 	return frame;
 }
 
+uint64_t Camera::frameTime(const camera_fb_t* frame){
+	const uint64_t time = FrameSource::frameTime(frame);
+	if(time <= frameTaken && frameTaken - time <= MaxFrameAge) return time;
+
+	if(!stampWarned){
+		ESP_LOGW(TAG, "frame timestamp %" PRIu64 " us not on the timer base, at %" PRIu64 " us", time, frameTaken);
+		stampWarned = true;
+	}
+	return frameTaken;
+}
+
+bool Camera::setFrameDivider(uint8_t divider){
+	if(!inited || divider == 0) return false;
+	if(divider == frameDivider) return true;
+
+	sensor_t* sensor = esp_camera_sensor_get();
+	if(sensor == nullptr || sensor->id.PID != OV2640_PID){
+		ESP_LOGW(TAG, "frame rate switching is only supported on the OV2640");
+		return false;
+	}
+
+	const uint32_t dummy = (divider - 1) * modeLines();
+
+	switchStart = micros();
+	Trace::begin(TraceId::CameraSwitch);
+	bool ok;
+	{
+		auto lock = i2c.lockBus();
+		ok = sensor->set_reg(sensor, RegFLL, 0xFF, dummy & 0xFF) >= 0 && sensor->set_reg(sensor, RegFLH, 0xFF, dummy >> 8) >= 0;
+	}
+	Trace::end(TraceId::CameraSwitch, divider);
+	switchWritten = micros();
+
+	if(!ok){
+		ESP_LOGE(TAG, "error writing the frame length");
+		return false;
+	}
+
+	frameDivider = divider;
+	switchPending = true;
+	return true;
+}
+
+uint32_t Camera::modeLines() const{
+	return res > FRAMESIZE_SVGA ? UxgaLines : (res > FRAMESIZE_CIF ? SvgaLines : CifLines);
+}
+
+bool Camera::getExposure(float& time, float& gain){
+	if(!inited) return false;
+
+	sensor_t* sensor = esp_camera_sensor_get();
+	if(sensor == nullptr || sensor->id.PID != OV2640_PID) return false;
+
+	int high, middle, low, gainReg;
+	{
+		auto lock = i2c.lockBus();
+		high = sensor->get_reg(sensor, RegReg45, 0x3F);
+		middle = sensor->get_reg(sensor, RegAec, 0xFF);
+		low = sensor->get_reg(sensor, RegReg04, 0x03);
+		gainReg = sensor->get_reg(sensor, RegGain, 0xFF);
+	}
+	if(high < 0 || middle < 0 || low < 0 || gainReg < 0) return false;
+
+	time = (float) ((high << 10) | (middle << 2) | low) / modeLines();
+
+	//every one of the upper 4 bits doubles the gain, the lower 4 add sixteenths
+	gain = (1 + (gainReg & 0x0F) / 16.0f) * (float) (1 << __builtin_popcount(gainReg >> 4));
+	return true;
+}
+
+bool Camera::setProfile(const SensorProfile& profile){
+	if(!inited) return false;
+
+	sensor_t* sensor = esp_camera_sensor_get();
+	if(sensor == nullptr) return false;
+
+	auto lock = i2c.lockBus();
+	bool ok = sensor->set_exposure_ctrl(sensor, !profile.manual) >= 0 && sensor->set_gain_ctrl(sensor, !profile.manual) >= 0;
+	if(profile.manual){
+		ok = ok && sensor->set_aec_value(sensor, profile.exposure) >= 0 && sensor->set_agc_gain(sensor, profile.gain) >= 0;
+	}else{
+		ok = ok && sensor->set_ae_level(sensor, profile.aeLevel) >= 0 &&
+			 sensor->set_gainceiling(sensor, (gainceiling_t) profile.gainCeiling) >= 0;
+	}
+
+	if(!ok){
+		ESP_LOGE(TAG, "error setting the exposure profile");
+	}
+	return ok;
+}
+
 void Camera::releaseFrame(){
 	if(!inited) return;
 	if(!frame) return;
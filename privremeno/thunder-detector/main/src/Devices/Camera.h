@@ -3,14 +3,33 @@
 
 #include <esp_camera.h>
 #include "Periph/I2C.h"
+#include "FrameSource.h"
 
-class Camera {
+class Camera : public FrameSource {
 public:
 	Camera(I2C& i2c);
-	virtual ~Camera();
+	~Camera() override;
 
-	camera_fb_t* getFrame();
-	void releaseFrame();
+	camera_fb_t* getFrame() override;
+	void releaseFrame() override;
+
+	/**
+	 * The driver stamps frames with esp_timer_get_time() at VSYNC, the micros() time base. A stamp after the frame
+	 * was returned or older than MaxFrameAge can't be, such frames are timed as returned instead, with a warning.
+	 */
+	uint64_t frameTime(const camera_fb_t* frame) override;
+
+	/**
+	 * Fast frame rate switch through the sensor's frame length registers, without the deinit()/init() cycle that
+	 * setRes() and setFormat() need. Dummy lines after each frame make the period 'divider' times the shortest.
+	 * OV2640 only. The time from the call to the first frame started after the registers were written is logged.
+	 */
+	bool setFrameDivider(uint8_t divider) override;
+
+	//Reads the exposure and gain registers, OV2640 only
+	bool getExposure(float& time, float& gain) override;
+
+	bool setProfile(const SensorProfile& profile) override;
 
 	void setRes(framesize_t res);
 	framesize_t getRes() const;
@@ -35,6 +54,24 @@ private:
 	static constexpr int MaxFailedFrames = 100;
 	int failedFrames = 0;
 
+	uint64_t frameTaken = 0; //[us] when getFrame() returned the frame
+	static constexpr uint64_t MaxFrameAge = 2000000; //[us] frames wait in the buffers for a few periods at most
+	bool stampWarned = false;
+
+	uint8_t frameDivider = 1;
+	bool switchPending = false;
+	uint64_t switchStart = 0, switchWritten = 0; //[us]
+
+	//OV2640 frame length adjustment in the sensor register bank, (bank << 8) | address for sensor_t::set_reg
+	static constexpr int RegFLL = 0x146, RegFLH = 0x147;
+
+	//OV2640 lines per frame including the blanking, of the sensor mode the resolution selects
+	static constexpr uint32_t CifLines = 336, SvgaLines = 672, UxgaLines = 1248;
+	uint32_t modeLines() const;
+
+	//OV2640 exposure, AEC[15:10] in REG45[5:0], AEC[9:2] and AEC[1:0] in REG04[1:0], and gain
+	static constexpr int RegGain = 0x100, RegReg04 = 0x104, RegAec = 0x110, RegReg45 = 0x145;
+
 	I2C& i2c;
 };
 
@@ -0,0 +1,56 @@
+#ifndef THUNDER_DETECTOR_FRAMESOURCE_H
+#define THUNDER_DETECTOR_FRAMESOURCE_H
+
+#include <esp_camera.h>
+
+/**
+ * Source of camera frames for VisualDetector - the camera on the device, recorded frames on host.
+ */
+class FrameSource {
+public:
+	virtual ~FrameSource() = default;
+
+	/**
+	 * @return frame, or nullptr on failure. Only one frame can be held at a time.
+	 */
+	virtual camera_fb_t* getFrame() = 0;
+	virtual void releaseFrame() = 0;
+
+	/**
+	 * When the frame started, from the timestamp the driver set at its VSYNC
+	 * @return [us] on the micros() time base
+	 */
+	virtual uint64_t frameTime(const camera_fb_t* frame){
+		return (uint64_t) frame->timestamp.tv_sec * 1000000 + frame->timestamp.tv_usec;
+	}
+
+	/**
+	 * Stretches the frame period to 'divider' times the shortest without reinitialising. Rows are read out at the
+	 * same pace, only the blanking after each frame grows.
+	 * @return false if the source can't
+	 */
+	virtual bool setFrameDivider(uint8_t){ return false; }
+
+	/**
+	 * Exposure the sensor's automatic control settled on, which the brightness of the frames hides
+	 * @param time receives the exposure time as a share of the shortest frame period
+	 * @param gain receives the analog gain, 1 for none
+	 * @return false if the source can't tell
+	 */
+	virtual bool getExposure(float&, float&){ return false; }
+
+	//Exposure and gain control of a scene profile
+	struct SensorProfile {
+		bool manual; //fixed exposure and gain, automatic control would darken the frames after a flash
+		uint16_t exposure; //[lines] manual exposure, 0 - 1200 on the OV2640
+		uint8_t gain; //manual gain, 0 - 30 for 1x - 32x
+		int8_t aeLevel; //[-2, 2] target brightness of the automatic control
+		uint8_t gainCeiling; //gainceiling_t, the automatic gain stays under 2x << gainCeiling
+	};
+
+	//@return false if the source can't
+	virtual bool setProfile(const SensorProfile&){ return false; }
+};
+
+
+#endif //THUNDER_DETECTOR_FRAMESOURCE_H
@@ -0,0 +1,57 @@
+#include "Mic.h"
+#include <esp_log.h>
+
+static const char* TAG = "Mic";
+
+Mic::Mic(uint32_t sampleRate, gpio_num_t clk, gpio_num_t data) : sampleRate(sampleRate){
+	i2s_chan_config_t rx_chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+	ESP_ERROR_CHECK(i2s_new_channel(&rx_chan_cfg, nullptr, &rx_chan));
+
+
+	i2s_pdm_rx_config_t pdm_rx_cfg = {
+			.clk_cfg = I2S_PDM_RX_CLK_DEFAULT_CONFIG(sampleRate),
+			.slot_cfg = I2S_PDM_RX_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+			.gpio_cfg = {
+					.clk = clk,
+					.din = data,
+					.invert_flags = {
+							.clk_inv = false,
+					},
+			},
+	};
+
+	ESP_ERROR_CHECK(i2s_channel_init_pdm_rx_mode(rx_chan, &pdm_rx_cfg));
+
+	i2s_event_callbacks_t callbacks = {};
+	callbacks.on_recv_q_ovf = onOverrun;
+	ESP_ERROR_CHECK(i2s_channel_register_event_callback(rx_chan, &callbacks, this));
+
+	ESP_ERROR_CHECK(i2s_channel_enable(rx_chan));
+	ESP_LOGD(TAG, "i2s inited");
+}
+
+Mic::~Mic(){
+	i2s_channel_disable(rx_chan);
+	i2s_del_channel(rx_chan);
+}
+
+size_t Mic::read(int16_t* buffer, size_t count){
+	size_t bytesRead = 0;
+	if(i2s_channel_read(rx_chan, (void*) buffer, count * sizeof(int16_t), &bytesRead, portMAX_DELAY) != ESP_OK){
+		return 0;
+	}
+	return bytesRead / sizeof(int16_t);
+}
+
+uint32_t Mic::getSampleRate() const{
+	return sampleRate;
+}
+
+uint32_t Mic::getOverruns() const{
+	return overruns;
+}
+
+bool IRAM_ATTR Mic::onOverrun(i2s_chan_handle_t, i2s_event_data_t*, void* arg){
+	((Mic*) arg)->overruns++;
+	return false;
+}
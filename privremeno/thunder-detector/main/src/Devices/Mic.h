@@ -0,0 +1,31 @@
+#ifndef THUNDER_DETECTOR_MIC_H
+#define THUNDER_DETECTOR_MIC_H
+
+#include "AudioSource.h"
+#include <driver/i2s_pdm.h>
+#include <atomic>
+
+/**
+ * PDM microphone on I2S, mono 16-bit.
+ */
+class Mic : public AudioSource {
+public:
+	Mic(uint32_t sampleRate, gpio_num_t clk, gpio_num_t data);
+	~Mic() override;
+
+	size_t read(int16_t* buffer, size_t count) override;
+	uint32_t getSampleRate() const override;
+
+	//DMA buffers the driver dropped because read() wasn't called in time
+	uint32_t getOverruns() const;
+
+private:
+	const uint32_t sampleRate;
+	i2s_chan_handle_t rx_chan;
+
+	std::atomic<uint32_t> overruns = 0;
+	static bool onOverrun(i2s_chan_handle_t handle, i2s_event_data_t* event, void* arg);
+};
+
+
+#endif //THUNDER_DETECTOR_MIC_H
@@ -0,0 +1,192 @@
+#include "EventLog.h"
+
+#ifdef CONFIG_EVENT_LOG
+
+#include "Util/Threaded.h"
+#include "Util/Timer.h"
+#include <esp_log.h>
+#include <unistd.h>
+#include <cstring>
+#include <cinttypes>
+
+static const char* TAG = "EventLog";
+
+static constexpr const char* LogPath = "/sd/events.bin";
+static constexpr const char* IndexPath = "/sd/events.idx";
+
+Queue<EventRecord>* EventLog::queue = nullptr;
+FILE* EventLog::file = nullptr;
+FILE* EventLog::index = nullptr;
+uint32_t EventLog::boot = 0;
+uint32_t EventLog::sequence = 0;
+std::atomic<uint32_t> EventLog::dropped = 0;
+EventRecord EventLog::batch[BatchRecords] = {};
+size_t EventLog::batched = 0;
+uint64_t EventLog::firstBatched = 0;
+uint64_t EventLog::lastSync = 0;
+
+void EventLog::start(){
+	if(!open()) return;
+
+	ESP_LOGI(TAG, "boot %" PRIu32 ", appending at record %" PRIu32, boot, sequence);
+
+	queue = new Queue<EventRecord>(CONFIG_EVENT_LOG_QUEUE, "EventLog");
+
+	//the first record of every boot is a sync point
+	sync();
+
+	static ThreadedClosure thread(&EventLog::loop, "EventLog", 4 * 1024, 1);
+	thread.start();
+}
+
+bool EventLog::open(){
+	file = fopen(LogPath, "r+b");
+
+	if(file){
+		EventLogHeader header;
+		if(fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, EventLogHeaderDefault.magic, 4) != 0 ||
+		   header.version != EventLogHeaderDefault.version || header.recordSize != sizeof(EventRecord)){
+			ESP_LOGE(TAG, "%s has an unknown format, not appending to it", LogPath);
+			fclose(file);
+			file = nullptr;
+			return false;
+		}
+
+		//continue after the last intact record, a torn batch from a power loss gets overwritten
+		fseek(file, 0, SEEK_END);
+		uint32_t count = (ftell(file) - sizeof(header)) / sizeof(EventRecord);
+		EventRecord last{};
+		while(count > 0){
+			fseek(file, sizeof(header) + (count - 1) * sizeof(EventRecord), SEEK_SET);
+			if(fread(&last, sizeof(last), 1, file) == 1 && last.crc == eventRecordCrc(last)) break;
+			count--;
+		}
+
+		boot = count > 0 ? last.boot + 1 : 0;
+		sequence = count;
+		fseek(file, sizeof(header) + count * sizeof(EventRecord), SEEK_SET);
+
+	}else{
+		file = fopen(LogPath, "w+b");
+		if(!file){
+			ESP_LOGE(TAG, "error opening %s on SD!", LogPath);
+			return false;
+		}
+		fwrite(&EventLogHeaderDefault, sizeof(EventLogHeaderDefault), 1, file);
+	}
+
+	//the index only speeds up seeking, readers rebuild it from the log when it's missing
+	index = fopen(IndexPath, "ab");
+	if(index){
+		fseek(index, 0, SEEK_END);
+		if(ftell(index) == 0){
+			fwrite(&EventIndexHeaderDefault, sizeof(EventIndexHeaderDefault), 1, index);
+		}
+	}else{
+		ESP_LOGW(TAG, "error opening %s on SD, continuing without index", IndexPath);
+	}
+
+	return true;
+}
+
+void EventLog::event(const SensorEvent& event){
+	EventRecord record{};
+	record.timestamp = event.timestamp / 1000;
+
+	if(event.type == SensorEvent::Type::Video){
+		record.type = EventRecordType::Video;
+		record.value = event.video.intensity;
+	}else{
+		record.type = EventRecordType::Audio;
+		record.value = (uint8_t) event.audio.type;
+	}
+
+	post(record);
+}
+
+void EventLog::strike(const Fusion::Strike& strike){
+	EventRecord record{};
+	record.type = EventRecordType::Strike;
+	record.timestamp = strike.videoTimestamp / 1000;
+	record.audioTimestamp = strike.audioTimestamp / 1000;
+	record.distance = strike.distance;
+
+	post(record);
+}
+
+uint32_t EventLog::getDropped(){
+	return dropped;
+}
+
+void EventLog::post(EventRecord& record){
+	if(!queue) return;
+
+	if(!queue->post(record, 0)){
+		dropped++;
+	}
+}
+
+void EventLog::loop(){
+	EventRecord record;
+
+	//wakes up at least every second to keep the flush and sync periods
+	if(queue->get(record, pdMS_TO_TICKS(1000))){
+		append(record);
+	}
+
+	const uint64_t now = millis();
+	if(now - lastSync >= CONFIG_EVENT_LOG_SYNC_S * 1000ULL){
+		sync();
+	}else if(batched > 0 && now - firstBatched >= CONFIG_EVENT_LOG_FLUSH_S * 1000ULL){
+		flush();
+	}
+}
+
+void EventLog::append(EventRecord& record){
+	record.sequence = sequence++;
+	record.boot = boot;
+	record.crc = eventRecordCrc(record);
+
+	if(batched == 0){
+		firstBatched = millis();
+	}
+	batch[batched++] = record;
+
+	if(batched == BatchRecords){
+		flush();
+	}
+}
+
+void EventLog::sync(){
+	EventRecord record{};
+	record.type = EventRecordType::Sync;
+	record.timestamp = millis();
+	record.audioTimestamp = dropped;
+
+	append(record);
+	lastSync = record.timestamp;
+
+	//everything up to the sync record is on the card before the index points at it
+	flush();
+
+	if(index){
+		const EventIndexEntry entry = { record.timestamp, record.boot, record.sequence };
+		fwrite(&entry, sizeof(entry), 1, index);
+		fflush(index);
+		fsync(fileno(index));
+	}
+}
+
+void EventLog::flush(){
+	if(batched == 0) return;
+
+	if(fwrite(batch, sizeof(EventRecord), batched, file) != batched){
+		ESP_LOGE(TAG, "error writing %s!", LogPath);
+	}
+	fflush(file);
+	fsync(fileno(file));
+
+	batched = 0;
+}
+
+#endif
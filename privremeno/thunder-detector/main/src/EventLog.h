@@ -0,0 +1,67 @@
+#ifndef THUNDER_DETECTOR_EVENTLOG_H
+#define THUNDER_DETECTOR_EVENTLOG_H
+
+#include <sdkconfig.h>
+#include "SensorEvent.hpp"
+#include "Fusion.h"
+
+#ifdef CONFIG_EVENT_LOG
+
+#include "EventLogFormat.h"
+#include "Util/Queue.h"
+#include <cstdio>
+#include <atomic>
+
+/**
+ * Append-only binary log of detections and strikes on SD, see EventLogFormat.h.
+ * event() and strike() only post to a queue and never block, a low-priority task writes the records
+ * in sector-sized batches, so the SD card never stalls the detector loops or fusion.
+ */
+class EventLog {
+public:
+	//Call after SD is mounted. Continues an existing log with the next boot number.
+	static void start();
+
+	static void event(const SensorEvent& event);
+	static void strike(const Fusion::Strike& strike);
+
+	//Records lost because the writer fell behind
+	static uint32_t getDropped();
+
+private:
+	static constexpr size_t BatchRecords = 16; //512 B, one sector
+
+	static Queue<EventRecord>* queue;
+	static FILE* file;
+	static FILE* index;
+
+	static uint32_t boot;
+	static uint32_t sequence;
+	static std::atomic<uint32_t> dropped;
+
+	static EventRecord batch[BatchRecords];
+	static size_t batched;
+	static uint64_t firstBatched; //[ms] when the oldest unwritten record was queued
+	static uint64_t lastSync; //[ms]
+
+	static bool open();
+	static void post(EventRecord& record);
+	static void loop();
+	static void append(EventRecord& record);
+	static void sync();
+	static void flush();
+};
+
+#else
+
+class EventLog {
+public:
+	static void start(){}
+	static void event(const SensorEvent&){}
+	static void strike(const Fusion::Strike&){}
+	static uint32_t getDropped(){ return 0; }
+};
+
+#endif
+
+#endif //THUNDER_DETECTOR_EVENTLOG_H
@@ -0,0 +1,63 @@
+#ifndef THUNDER_DETECTOR_EVENTLOGFORMAT_H
+#define THUNDER_DETECTOR_EVENTLOGFORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+
+//Binary event log format, shared between the firmware (EventLog) and host/src/EventLogReader.
+//events.bin is an EventLogHeader followed by fixed-size EventRecords, appended across boots.
+//events.idx is an EventIndexHeader followed by an EventIndexEntry for every Sync record, so a reader can
+//binary-search by (boot, timestamp) and can always rebuild the index by scanning the log for Sync records.
+
+enum class EventRecordType : uint8_t {
+	Sync, //written at boot and periodically, marks the log as alive up to 'timestamp'
+	Video,
+	Audio,
+	Strike
+};
+
+struct EventRecord {
+	uint64_t timestamp; //[ms] since boot: of the event, of the flash of a Strike, of writing a Sync
+	uint64_t audioTimestamp; //Strike: [ms] of the thunder, Sync: records dropped so far in this boot
+	uint32_t sequence; //position in the log, continues across boots
+	uint32_t boot; //incremented at every boot, timestamps restart with it
+	float distance; //Strike: [m]
+	EventRecordType type;
+	uint8_t value; //Video: intensity, Audio: ThunderType
+	uint16_t crc; //eventRecordCrc() with this field zeroed, a torn or stale record doesn't match
+};
+static_assert(sizeof(EventRecord) == 32);
+
+struct EventIndexEntry {
+	uint64_t timestamp; //[ms] of the Sync record
+	uint32_t boot;
+	uint32_t sequence; //of the Sync record
+};
+static_assert(sizeof(EventIndexEntry) == 16);
+
+struct EventLogHeader {
+	char magic[4]; //"THEV" for the log, "THEI" for the index
+	uint16_t version;
+	uint16_t recordSize; //of EventRecord or EventIndexEntry
+};
+
+static constexpr EventLogHeader EventLogHeaderDefault = { { 'T', 'H', 'E', 'V' }, 1, sizeof(EventRecord) };
+static constexpr EventLogHeader EventIndexHeaderDefault = { { 'T', 'H', 'E', 'I' }, 1, sizeof(EventIndexEntry) };
+
+//CRC-16/CCITT over the record with the crc field taken as zero
+inline uint16_t eventRecordCrc(const EventRecord& record){
+	EventRecord copy = record;
+	copy.crc = 0;
+
+	const auto* bytes = (const uint8_t*) &copy;
+	uint16_t crc = 0xFFFF;
+	for(size_t i = 0; i < sizeof(copy); i++){
+		crc ^= bytes[i] << 8;
+		for(int bit = 0; bit < 8; bit++){
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+		}
+	}
+	return crc;
+}
+
+#endif //THUNDER_DETECTOR_EVENTLOGFORMAT_H
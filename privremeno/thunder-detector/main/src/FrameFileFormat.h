@@ -0,0 +1,30 @@
+#ifndef THUNDER_DETECTOR_FRAMEFILEFORMAT_H
+#define THUNDER_DETECTOR_FRAMEFILEFORMAT_H
+
+#include <cstdint>
+
+//Recorded frame sequence for replay, shared between the firmware (FrameLog) and the host tools: a FrameFileHeader,
+//then for every frame a FrameFileEntry followed by 'len' bytes of pixel data, exactly as the camera delivers it
+//(RGB565 is big-endian per pixel), or coded 8-bit grayscale (FrameFileCoded, Util/FrameCodec.h).
+
+struct FrameFileHeader {
+	char magic[4]; //"THFR"
+	uint16_t version;
+	uint16_t format; //pixformat_t or FrameFileCoded
+	uint16_t width;
+	uint16_t height;
+};
+
+struct FrameFileEntry {
+	uint64_t timestamp; //[us], on the replay timeline
+	uint32_t len;
+	uint32_t reserved;
+};
+
+static constexpr char FrameFileMagic[4] = { 'T', 'H', 'F', 'R' };
+static constexpr uint16_t FrameFileVersion = 1;
+
+//Frames coded with FrameEncoder, the first one is a key frame
+static constexpr uint16_t FrameFileCoded = 0x100;
+
+#endif //THUNDER_DETECTOR_FRAMEFILEFORMAT_H
@@ -0,0 +1,155 @@
+#include "FrameLog.h"
+
+#ifdef CONFIG_FRAME_LOG
+
+#include "FrameFileFormat.h"
+#include "Util/Threaded.h"
+#include "Util/Timer.h"
+#include "Util/Trace.h"
+#include <esp_log.h>
+#include "Util/Memory.h"
+#include <sys/stat.h>
+#include <cstdio>
+#include <cstring>
+#include <cinttypes>
+
+static const char* TAG = "FrameLog";
+
+static constexpr uint32_t ReportPeriod = 60 * 1000; //[ms]
+
+uint16_t FrameLog::width = 0;
+uint16_t FrameLog::height = 0;
+Queue<FrameLog::Slot>* FrameLog::freeSlots = nullptr;
+Queue<FrameLog::Slot>* FrameLog::fullSlots = nullptr;
+std::atomic<uint32_t> FrameLog::dropped = 0;
+FrameEncoder* FrameLog::encoder = nullptr;
+uint8_t* FrameLog::coded = nullptr;
+SDWriter* FrameLog::writer = nullptr;
+char FrameLog::path[16] = {};
+uint32_t FrameLog::frames = 0;
+uint64_t FrameLog::pixelBytes = 0;
+uint64_t FrameLog::codedBytes = 0;
+uint64_t FrameLog::encodeTime = 0;
+uint64_t FrameLog::lastReport = 0;
+
+void FrameLog::start(uint16_t width, uint16_t height){
+	FrameLog::width = width;
+	FrameLog::height = height;
+
+	encoder = new FrameEncoder(width, height, CONFIG_FRAME_LOG_NEAR);
+	//written once per frame by the encoder, read once by the writer
+	Memory::Region placed;
+	coded = (uint8_t*) Memory::alloc(Memory::Region::Bulk, encoder->maxOutput(), "frame log", placed);
+	if(!coded) return;
+
+	writer = new SDWriter(16 * 1024);
+	if(!open()) return;
+
+	freeSlots = new Queue<Slot>(Slots, "FrameFree");
+	fullSlots = new Queue<Slot>(Slots, "FrameFull");
+	for(size_t i = 0; i < Slots; i++){
+		Slot slot = { (uint8_t*) Memory::alloc(Memory::Region::Bulk, width * height, "frame log slots", placed), 0 };
+		if(!slot.pixels) return;
+		freeSlots->post(slot);
+	}
+
+	lastReport = millis();
+
+	//the detectors run on core 0 (video) and 1 (audio), below both
+	static ThreadedClosure thread(&FrameLog::loop, "FrameLog", 4 * 1024, 2, 1);
+	thread.start();
+}
+
+bool FrameLog::open(){
+	//a new file every boot, 8.3 names
+	struct stat st;
+	uint32_t index = 0;
+	while(snprintf(path, sizeof(path), "/sd/fr%05" PRIu32 ".thf", index), stat(path, &st) == 0){
+		index++;
+	}
+
+	if(!writer->open(path)){
+		ESP_LOGE(TAG, "error opening %s on SD!", path);
+		return false;
+	}
+
+	FrameFileHeader header{};
+	memcpy(header.magic, FrameFileMagic, 4);
+	header.version = FrameFileVersion;
+	header.format = FrameFileCoded;
+	header.width = width;
+	header.height = height;
+	writer->write(&header, sizeof(header));
+
+	ESP_LOGI(TAG, "logging %ux%u frames to %s", width, height, path);
+	return true;
+}
+
+void FrameLog::frame(uint64_t timestamp, const uint8_t* pixels){
+	if(!fullSlots) return;
+
+	Slot slot;
+	if(!freeSlots->get(slot, 0)){
+		dropped++;
+		return;
+	}
+
+	memcpy(slot.pixels, pixels, width * height);
+	slot.timestamp = timestamp;
+	fullSlots->post(slot);
+}
+
+uint32_t FrameLog::getDropped(){
+	return dropped;
+}
+
+void FrameLog::loop(){
+	Slot slot;
+	if(fullSlots->get(slot, pdMS_TO_TICKS(1000))){
+		write(slot);
+		freeSlots->post(slot);
+	}
+
+	if(millis() - lastReport >= ReportPeriod){
+		report();
+	}
+}
+
+void FrameLog::write(const Slot& slot){
+	//a key frame every so often, so a damaged frame only spoils the frames up to the next one
+	const bool key = frames % CONFIG_FRAME_LOG_KEY_INTERVAL == 0;
+
+	const uint64_t start = micros();
+	Trace::begin(TraceId::FrameEncode);
+	const size_t size = encoder->encode(slot.pixels, key, coded);
+	Trace::end(TraceId::FrameEncode, size);
+	encodeTime += micros() - start;
+
+	const FrameFileEntry entry = { slot.timestamp, (uint32_t) size, 0 };
+	if(!writer->write(&entry, sizeof(entry)) || !writer->write(coded, size)){
+		ESP_LOGE(TAG, "error writing %s!", path);
+	}
+
+	//commit the file size at key frames, a power loss then costs at most one key interval
+	if(key){
+		writer->sync();
+	}
+
+	frames++;
+	pixelBytes += width * height;
+	codedBytes += sizeof(entry) + size;
+}
+
+void FrameLog::report(){
+	const uint64_t now = millis();
+	const uint32_t count = pixelBytes / (width * height);
+
+	ESP_LOGI(TAG, "%" PRIu32 " frames, %.1f kB/s, coded %.2f:1, %.2f ms per frame, %" PRIu32 " dropped", count,
+			 (float) codedBytes / (now - lastReport), codedBytes ? (float) pixelBytes / codedBytes : 0.0f,
+			 count ? encodeTime / (count * 1000.0f) : 0.0f, dropped.load());
+
+	pixelBytes = codedBytes = encodeTime = 0;
+	lastReport = now;
+}
+
+#endif
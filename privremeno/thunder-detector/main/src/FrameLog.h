@@ -0,0 +1,74 @@
+#ifndef THUNDER_DETECTOR_FRAMELOG_H
+#define THUNDER_DETECTOR_FRAMELOG_H
+
+#include <sdkconfig.h>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef CONFIG_FRAME_LOG
+
+#include "Util/Queue.h"
+#include "Util/FrameCodec.h"
+#include "Periph/SDWriter.h"
+#include <atomic>
+
+/**
+ * Continuous archive of every grayscale detector frame on SD, in a FrameFile (FrameFileFormat.h) of frames
+ * coded with FrameEncoder, one /sd/frNNNNN.thf per boot. frame() only copies the frame into a free slot and
+ * never blocks, a low-priority task on the other core codes and writes it. Replays directly on host.
+ */
+class FrameLog {
+public:
+	//Call after SD is mounted
+	static void start(uint16_t width, uint16_t height);
+
+	/**
+	 * @param timestamp [us] of the capture
+	 * @param pixels width x height, as given to start()
+	 */
+	static void frame(uint64_t timestamp, const uint8_t* pixels);
+
+	//Frames lost because the writer fell behind
+	static uint32_t getDropped();
+
+private:
+	struct Slot {
+		uint8_t* pixels;
+		uint64_t timestamp;
+	};
+
+	static constexpr size_t Slots = 3;
+
+	static uint16_t width, height;
+	static Queue<Slot>* freeSlots;
+	static Queue<Slot>* fullSlots;
+	static std::atomic<uint32_t> dropped;
+
+	static FrameEncoder* encoder;
+	static uint8_t* coded;
+	static SDWriter* writer;
+	static char path[16];
+
+	static uint32_t frames;
+	static uint64_t pixelBytes, codedBytes; //since the last report
+	static uint64_t encodeTime; //[us] since the last report
+	static uint64_t lastReport; //[ms]
+
+	static bool open();
+	static void loop();
+	static void write(const Slot& slot);
+	static void report();
+};
+
+#else
+
+class FrameLog {
+public:
+	static void start(uint16_t, uint16_t){}
+	static void frame(uint64_t, const uint8_t*){}
+	static uint32_t getDropped(){ return 0; }
+};
+
+#endif
+
+#endif //THUNDER_DETECTOR_FRAMELOG_H
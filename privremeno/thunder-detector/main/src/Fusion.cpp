@@ -0,0 +1,52 @@
+#include "Fusion.h"
+#include "Util/DeferredLog.h"
+#include <cinttypes>
+
+static const char* TAG = "Fusion";
+
+bool Fusion::process(const SensorEvent& event, Strike& strike){
+	if(event.type == SensorEvent::Type::Audio){
+
+		auto audioEvent = event.audio;
+		if(audioEvent.type == ThunderType::Clap){
+			DLOGI(TAG, "Clap at %" PRIu64 " us!", event.timestamp);
+
+			if(!recognizedVideo){
+				DLOGI(TAG, "Clap ignored, no preceding video event");
+				return false;
+			}
+
+
+			const int64_t timeDiff = (int64_t) (event.timestamp - storedVideo.timestamp); //[us]
+
+			//can't be its thunder, the flash still waits for one
+			if(timeDiff < 0){
+				DLOGI(TAG, "Clap ignored, it started before the video event");
+				return false;
+			}
+			recognizedVideo = false;
+			if(timeDiff > AudioDelayCutoff){
+				DLOGI(TAG, "Clap ignored, too much time passed since video event");
+				return false;
+			}
+
+			const float distance = timeDiff * V_sound / 1000000.0f; //distance in meters
+			DLOGI(TAG, "Possible thunderstrike detected, distance: %.2f m, timestamp: %" PRIu64 " us", distance, storedVideo.timestamp);
+
+			strike = { storedVideo.timestamp, event.timestamp, distance };
+			return true;
+		}
+	}else if(event.type == SensorEvent::Type::Video){
+
+		auto videoEvent = event.video;
+		if(videoEvent.intensity > 0){
+			DLOGI(TAG, "Video change at %" PRIu64 " us, %u regions, largest elongated %.1f! Waiting for a thunder follow-up...", event.timestamp,
+				  videoEvent.regions, videoEvent.elongation);
+			recognizedVideo = true;
+			storedVideo = event;
+		}
+
+	}
+
+	return false;
+}
@@ -0,0 +1,34 @@
+#ifndef THUNDER_DETECTOR_FUSION_H
+#define THUNDER_DETECTOR_FUSION_H
+
+#include "SensorEvent.hpp"
+
+/**
+ * Pairs a video event (flash) with the following audio event (thunder clap) and estimates the strike distance
+ * from the delay between them.
+ */
+class Fusion {
+public:
+	struct Strike {
+		uint64_t videoTimestamp; //[us]
+		uint64_t audioTimestamp; //[us]
+		float distance; //[m]
+	};
+
+	/**
+	 * @param strike filled in when true is returned
+	 * @return true if 'event' completed a strike
+	 */
+	bool process(const SensorEvent& event, Strike& strike);
+
+	static constexpr int64_t AudioDelayCutoff = 60000000; //[us] 60 seconds shouldn't be audible/visible
+	static constexpr int V_sound = 343; //[m/s], speed of sound constant
+
+private:
+	bool recognizedVideo = false;
+	SensorEvent storedVideo{};
+
+};
+
+
+#endif //THUNDER_DETECTOR_FUSION_H
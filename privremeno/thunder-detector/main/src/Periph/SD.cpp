@@ -1,9 +1,19 @@
 #include "SD.h"
+#include <driver/gpio.h>
+
+#ifndef CONFIG_SD_BUS_SPI
+#include <driver/sdmmc_host.h>
+#endif
 
 static const char* TAG = "SD";
 
+#ifdef CONFIG_SD_BUS_SPI
 sdmmc_host_t SD::host = SDSPI_HOST_DEFAULT();
+#else
+sdmmc_host_t SD::host = SDMMC_HOST_DEFAULT();
+#endif
 sdmmc_card_t* SD::card = nullptr;
+const char* SD::mountpoint = BasePath;
 
 bool SD::init(gpio_num_t miso, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, const char* mountpoint){
 	esp_err_t ret;
@@ -12,11 +22,15 @@ bool SD::init(gpio_num_t miso, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, c
 	// formatted in case when mounting fails.
 	esp_vfs_fat_sdmmc_mount_config_t mount_config = {
 			.format_if_mount_failed = true,
-			.max_files = 5,
-			.allocation_unit_size = 8 * 1024
+			.max_files = CONFIG_SD_MAX_FILES,
+			.allocation_unit_size = CONFIG_SD_ALLOCATION_UNIT
 	};
 	ESP_LOGI(TAG, "Initializing SD card");
 
+	SD::mountpoint = mountpoint;
+	host.max_freq_khz = CONFIG_SD_FREQ_KHZ;
+
+#ifdef CONFIG_SD_BUS_SPI
 	spi_bus_config_t bus_cfg = {
 			.mosi_io_num = mosi,
 			.miso_io_num = miso,
@@ -37,7 +51,30 @@ bool SD::init(gpio_num_t miso, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, c
 	slot_config.gpio_cs = cs;
 	slot_config.host_id = (spi_host_device_t) host.slot;
 
-	ret = esp_vfs_fat_sdspi_mount(BasePath, &host, &slot_config, &mount_config, &card);
+	ret = esp_vfs_fat_sdspi_mount(mountpoint, &host, &slot_config, &mount_config, &card);
+#else
+	//SD mode on the SPI wiring, without SPI framing and with multi-block DMA transfers
+	sdmmc_slot_config_t slot_config = SDMMC_SLOT_CONFIG_DEFAULT();
+	slot_config.clk = clk;
+	slot_config.cmd = mosi;
+	slot_config.d0 = miso;
+#ifdef CONFIG_SD_BUS_SDMMC_4BIT
+	slot_config.width = 4;
+	slot_config.d1 = (gpio_num_t) CONFIG_SD_D1_GPIO;
+	slot_config.d2 = (gpio_num_t) CONFIG_SD_D2_GPIO;
+	slot_config.d3 = cs;
+#else
+	slot_config.width = 1;
+	//D3 is the SPI chip select, the card only stays in SD mode while it's high
+	if(cs != GPIO_NUM_NC){
+		gpio_set_direction(cs, GPIO_MODE_OUTPUT);
+		gpio_set_level(cs, 1);
+	}
+#endif
+	slot_config.flags |= SDMMC_SLOT_FLAG_INTERNAL_PULLUP;
+
+	ret = esp_vfs_fat_sdmmc_mount(mountpoint, &host, &slot_config, &mount_config, &card);
+#endif
 
 	if(ret != ESP_OK){
 		if(ret == ESP_FAIL){
@@ -55,6 +92,10 @@ bool SD::init(gpio_num_t miso, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs, c
 	return true;
 }
 
+sdmmc_card_t* SD::getCard(){
+	return card;
+}
+
 void SD::deinit(){
-	esp_vfs_fat_sdcard_unmount(BasePath, card);
+	esp_vfs_fat_sdcard_unmount(mountpoint, card);
 }
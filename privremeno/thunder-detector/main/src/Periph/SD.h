@@ -3,18 +3,27 @@
 
 #include "esp_vfs_fat.h"
 #include "sdmmc_cmd.h"
+#include <sdkconfig.h>
 #include <soc/gpio_num.h>
 
 class SD {
 public:
+	/**
+	 * Mounts the card over the bus selected by CONFIG_SD_BUS. The SDMMC host uses the same wires as SPI:
+	 * CMD on mosi, D0 on miso and D3 on cs, with D1 and D2 from CONFIG_SD_D1_GPIO/CONFIG_SD_D2_GPIO in 4-bit mode.
+	 */
 	static bool init(gpio_num_t miso, gpio_num_t mosi, gpio_num_t clk, gpio_num_t cs = GPIO_NUM_NC, const char* mountpoint = BasePath);
 	static void deinit();
 
+	//Mounted card, for raw sector access outside the FAT partition
+	static sdmmc_card_t* getCard();
+
 private:
 	static constexpr const char* BasePath = "/sd";
 
 	static sdmmc_host_t host;
 	static sdmmc_card_t *card;
+	static const char* mountpoint;
 };
 
 
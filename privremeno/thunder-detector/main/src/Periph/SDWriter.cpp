@@ -0,0 +1,135 @@
+#include "SDWriter.h"
+#include <esp_log.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <string>
+#include <algorithm>
+
+#ifdef ESP_PLATFORM
+#include <esp_vfs_fat.h>
+#endif
+
+static const char* TAG = "SDWriter";
+
+SDWriter::SDWriter(size_t bufferSize) : capacity(std::max(bufferSize / SectorSize, (size_t) 1) * SectorSize){
+	buffer = (uint8_t*) Memory::alloc(Memory::Region::Dma, capacity, "SD writer", placed);
+}
+
+SDWriter::~SDWriter(){
+	close();
+	Memory::free(buffer, capacity, placed);
+}
+
+bool SDWriter::open(const char* path, size_t preallocate){
+	close();
+	if(!buffer) return false;
+
+	preallocate = (preallocate + SectorSize - 1) / SectorSize * SectorSize;
+	preallocated = false;
+
+#ifdef ESP_PLATFORM
+	if(preallocate > 0){
+		//mount point is the first path component, e.g. "/sd"
+		const char* end = strchr(path + 1, '/');
+		const std::string base(path, end ? end - path : strlen(path));
+
+		unlink(path);
+		const esp_err_t err = esp_vfs_fat_create_contiguous_file(base.c_str(), path, preallocate, true);
+		if(err == ESP_OK){
+			preallocated = true;
+		}else{
+			ESP_LOGW(TAG, "can't preallocate %zu B for %s (%s), growing it instead", preallocate, path, esp_err_to_name(err));
+		}
+	}
+#endif
+
+	fd = ::open(path, O_WRONLY | O_CREAT | (preallocated ? 0 : O_TRUNC), 0644);
+	if(fd < 0){
+		ESP_LOGE(TAG, "error opening %s on SD!", path);
+		return false;
+	}
+
+#ifndef ESP_PLATFORM
+	if(preallocate > 0){
+		preallocated = posix_fallocate(fd, 0, preallocate) == 0;
+	}
+#endif
+
+	offset = 0;
+	buffered = 0;
+	return true;
+}
+
+bool SDWriter::write(const void* data, size_t size){
+	if(fd < 0) return false;
+
+	auto bytes = (const uint8_t*) data;
+	while(size > 0){
+		const size_t chunk = std::min(size, capacity - buffered);
+		memcpy(buffer + buffered, bytes, chunk);
+		buffered += chunk;
+		bytes += chunk;
+		size -= chunk;
+
+		if(buffered == capacity && !writeSectors()) return false;
+	}
+
+	return true;
+}
+
+//Writes the whole sectors in the buffer and moves the partial last one to its front
+bool SDWriter::writeSectors(){
+	const size_t sectors = buffered / SectorSize * SectorSize;
+	if(sectors == 0) return true;
+
+	if(::write(fd, buffer, sectors) != (ssize_t) sectors){
+		ESP_LOGE(TAG, "error writing to SD!");
+		return false;
+	}
+
+	offset += sectors;
+	buffered -= sectors;
+	memmove(buffer, buffer + sectors, buffered);
+	return true;
+}
+
+bool SDWriter::flush(){
+	if(fd < 0) return false;
+	if(!writeSectors()) return false;
+	if(buffered == 0) return true;
+
+	if(::write(fd, buffer, buffered) != (ssize_t) buffered){
+		ESP_LOGE(TAG, "error writing to SD!");
+		return false;
+	}
+	return lseek(fd, offset, SEEK_SET) == (off_t) offset;
+}
+
+bool SDWriter::sync(){
+	return flush() && fsync(fd) == 0;
+}
+
+bool SDWriter::close(){
+	if(fd < 0) return true;
+
+	bool ok = flush();
+	offset += buffered;
+	buffered = 0;
+
+	if(preallocated){
+		ok = ftruncate(fd, offset) == 0 && ok;
+	}
+
+	ok = ::close(fd) == 0 && ok;
+	fd = -1;
+	return ok;
+}
+
+bool SDWriter::isOpen() const{
+	return fd >= 0;
+}
+
+size_t SDWriter::getSize() const{
+	return offset + buffered;
+}
@@ -0,0 +1,65 @@
+#ifndef THUNDER_DETECTOR_SDWRITER_H
+#define THUNDER_DETECTOR_SDWRITER_H
+
+#include "Util/Memory.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Buffered file writer for the SD card. Data is collected in a DMA-capable internal RAM buffer and
+ * written as whole sectors at sector-aligned file offsets, which FATFS hands to the card driver as one
+ * multi-block transfer straight from the buffer, without its sector cache or a bounce buffer.
+ * Files can be preallocated as one contiguous cluster chain, so appending never stops to search and
+ * update the FAT.
+ */
+class SDWriter {
+public:
+	static constexpr size_t SectorSize = 512;
+
+	/**
+	 * @param bufferSize rounded down to whole sectors, writes to the card happen in chunks of this size
+	 */
+	SDWriter(size_t bufferSize = 16 * 1024);
+	~SDWriter();
+
+	/**
+	 * Creates or truncates 'path'.
+	 * @param preallocate [bytes] allocated contiguously up front, the file is truncated to the written
+	 * size on close(). Until then it reads back as this long, so only use it for files that get closed.
+	 * 0 lets the file grow as it's written.
+	 */
+	bool open(const char* path, size_t preallocate = 0);
+
+	bool write(const void* data, size_t size);
+
+	/**
+	 * Writes out everything buffered, including a partial last sector. The file position stays at the
+	 * start of that sector, so the next write() rewrites it whole and writes stay aligned.
+	 */
+	bool flush();
+
+	//flush() and commit the file size and FAT to the card
+	bool sync();
+
+	bool close();
+
+	bool isOpen() const;
+
+	//Bytes written since open()
+	size_t getSize() const;
+
+private:
+	uint8_t* buffer = nullptr;
+	Memory::Region placed;
+	const size_t capacity;
+	size_t buffered = 0;
+
+	int fd = -1;
+	size_t offset = 0; //file offset of buffer[0], always sector-aligned
+	bool preallocated = false;
+
+	bool writeSectors();
+};
+
+
+#endif //THUNDER_DETECTOR_SDWRITER_H
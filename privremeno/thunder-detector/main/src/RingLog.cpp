@@ -0,0 +1,297 @@
+#include "RingLog.h"
+
+#ifdef CONFIG_RING_LOG
+
+#include "Util/Timer.h"
+#include "Util/Trace.h"
+#include <esp_log.h>
+#include "Util/Memory.h"
+#include <esp_random.h>
+#include <cstring>
+#include <cstddef>
+#include <cinttypes>
+#include <algorithm>
+
+static const char* TAG = "RingLog";
+
+static constexpr size_t StagingSize = CONFIG_RING_LOG_STAGING * 1024;
+
+sdmmc_card_t* RingLog::card = nullptr;
+uint32_t RingLog::partitionStart = 0;
+RingSuperblock RingLog::superblock = {};
+std::mutex RingLog::mutex;
+uint8_t* RingLog::staging = nullptr;
+uint64_t RingLog::sequence = 0;
+uint32_t RingLog::head = 0;
+uint32_t RingLog::boot = 0;
+uint32_t RingLog::checkpoints = 0;
+uint64_t RingLog::lastCheckpoint = 0;
+
+bool RingLog::start(sdmmc_card_t* card){
+	if(card == nullptr) return false;
+	RingLog::card = card;
+
+	Memory::Region placed;
+	staging = (uint8_t*) Memory::alloc(Memory::Region::Dma, StagingSize, "ring staging", placed);
+	if(!staging){
+		RingLog::card = nullptr;
+		return false;
+	}
+
+	bool ok = findPartition() && readSector(0);
+	if(ok){
+		RingSuperblock stored;
+		memcpy(&stored, staging, sizeof(stored));
+
+		//a partition resized since formatting gets formatted again
+		if(memcmp(stored.magic, RingSuperblockMagic, 4) != 0 || stored.version != RingVersion || stored.sectorSize != RingSectorSize ||
+		   stored.dataSectors != superblock.dataSectors || stored.crc != ringCrc32(&stored, offsetof(RingSuperblock, crc))){
+			ok = format();
+		}else{
+			superblock = stored;
+			recover();
+		}
+	}
+
+	if(!ok){
+		Memory::free(staging, StagingSize, placed);
+		staging = nullptr;
+		RingLog::card = nullptr;
+		return false;
+	}
+
+	checkpoint();
+
+	ESP_LOGI(TAG, "ring %08" PRIx32 " of %" PRIu32 " sectors, boot %" PRIu32 ", next record %" PRIu64 " at sector %" PRIu32,
+			 superblock.ringId, superblock.dataSectors, boot, sequence, head);
+	return true;
+}
+
+bool RingLog::findPartition(){
+	if(!readSector(0)) return false;
+
+	if(staging[510] != 0x55 || staging[511] != 0xAA){
+		ESP_LOGE(TAG, "no MBR on the card");
+		return false;
+	}
+
+	for(int i = 0; i < 4; i++){
+		const uint8_t* entry = staging + 446 + i * 16;
+		if(entry[4] != RingPartitionType) continue;
+
+		uint32_t sectors;
+		memcpy(&partitionStart, entry + 8, 4);
+		memcpy(&sectors, entry + 12, 4);
+
+		if(sectors <= RingDataStart){
+			ESP_LOGE(TAG, "ring partition is too small");
+			return false;
+		}
+		superblock.dataSectors = sectors - RingDataStart;
+		return true;
+	}
+
+	ESP_LOGE(TAG, "no partition of type %02X on the card", RingPartitionType);
+	return false;
+}
+
+bool RingLog::format(){
+	superblock = { { 'T', 'H', 'R', 'S' }, RingVersion, RingSectorSize, esp_random(), superblock.dataSectors, 0 };
+	superblock.crc = ringCrc32(&superblock, offsetof(RingSuperblock, crc));
+
+	ESP_LOGW(TAG, "formatting ring %08" PRIx32, superblock.ringId);
+
+	memset(staging, 0, RingSectorSize);
+	memcpy(staging, &superblock, sizeof(superblock));
+
+	sequence = 0;
+	head = 0;
+	boot = 0;
+	return writeSectors(0, 1);
+}
+
+void RingLog::recover(){
+	RingCheckpoint newest{};
+	bool found = false;
+
+	for(uint32_t sector = 1; sector < RingDataStart; sector++){
+		if(!readSector(sector)) continue;
+
+		RingCheckpoint cp;
+		memcpy(&cp, staging, sizeof(cp));
+		if(memcmp(cp.magic, RingCheckpointMagic, 4) != 0 || cp.ringId != superblock.ringId ||
+		   cp.crc != ringCrc32(&cp, offsetof(RingCheckpoint, crc)) || cp.head >= superblock.dataSectors) continue;
+
+		if(!found || cp.sequence > newest.sequence){
+			newest = cp;
+			found = true;
+		}
+	}
+
+	sequence = newest.sequence;
+	head = newest.head;
+	uint32_t lastBoot = newest.boot;
+
+	//follow the records written after the checkpoint
+	RingRecordHeader header;
+	for(;;){
+		if(readHeader(head, header) && header.sequence == sequence){
+		}else if(head != 0 && readHeader(0, header) && header.sequence == sequence){
+			head = 0; //wrapped
+		}else{
+			break;
+		}
+
+		lastBoot = std::max(lastBoot, header.boot);
+		head += ringSectors(header.size);
+		sequence++;
+	}
+
+	boot = (found || sequence > 0) ? lastBoot + 1 : 0;
+}
+
+bool RingLog::checkpoint(){
+	RingCheckpoint cp = { { 'T', 'H', 'R', 'C' }, superblock.ringId, sequence, head, boot, 0, 0 };
+	cp.crc = ringCrc32(&cp, offsetof(RingCheckpoint, crc));
+
+	memset(staging, 0, RingSectorSize);
+	memcpy(staging, &cp, sizeof(cp));
+
+	//alternating between two sectors, a torn write leaves the other one intact
+	lastCheckpoint = millis();
+	return writeSectors(1 + checkpoints++ % 2, 1);
+}
+
+bool RingLog::frame(uint64_t timestamp, const uint8_t* pixels, uint16_t width, uint16_t height){
+	RingRecordHeader header{};
+	header.type = RingRecordType::Frame;
+	header.timestamp = timestamp;
+	header.size = width * height;
+	header.width = width;
+	header.height = height;
+	return write(header, pixels);
+}
+
+bool RingLog::audio(uint64_t timestamp, const int16_t* samples, size_t count, uint32_t sampleRate){
+	RingRecordHeader header{};
+	header.type = RingRecordType::Audio;
+	header.timestamp = timestamp;
+	header.size = count * sizeof(int16_t);
+	header.sampleRate = sampleRate;
+	return write(header, samples);
+}
+
+bool RingLog::event(const SensorEvent& event){
+	RingEvent payload{};
+	if(event.type == SensorEvent::Type::Video){
+		payload.type = RingEventType::Video;
+		payload.value = event.video.intensity;
+	}else{
+		payload.type = RingEventType::Audio;
+		payload.value = (uint8_t) event.audio.type;
+	}
+
+	RingRecordHeader header{};
+	header.type = RingRecordType::Event;
+	header.timestamp = event.timestamp / 1000;
+	header.size = sizeof(payload);
+	return write(header, &payload);
+}
+
+bool RingLog::strike(const Fusion::Strike& strike){
+	RingEvent payload{};
+	payload.type = RingEventType::Strike;
+	payload.audioTimestamp = strike.audioTimestamp / 1000;
+	payload.distance = strike.distance;
+
+	RingRecordHeader header{};
+	header.type = RingRecordType::Event;
+	header.timestamp = strike.videoTimestamp / 1000;
+	header.size = sizeof(payload);
+	return write(header, &payload);
+}
+
+bool RingLog::write(RingRecordHeader& header, const void* payload){
+	if(!card) return false;
+
+	const uint32_t sectors = ringSectors(header.size);
+	if(sectors > superblock.dataSectors) return false;
+
+	std::lock_guard lock(mutex);
+	TraceSpan span(TraceId::SDWrite, header.size);
+
+	if(head + sectors > superblock.dataSectors){
+		head = 0;
+	}
+
+	memcpy(header.magic, RingRecordMagic, 4);
+	header.ringId = superblock.ringId;
+	header.sequence = sequence;
+	header.boot = boot;
+	header.payloadCrc = ringCrc32(payload, header.size);
+	header.headerCrc = ringCrc32(&header, offsetof(RingRecordHeader, headerCrc));
+
+	//header and payload go through the staging buffer, written in chunks of whole sectors
+	memcpy(staging, &header, sizeof(header));
+	size_t used = sizeof(header);
+	auto src = (const uint8_t*) payload;
+	size_t remaining = header.size;
+	uint32_t sector = RingDataStart + head;
+
+	for(;;){
+		const size_t chunk = std::min(remaining, StagingSize - used);
+		memcpy(staging + used, src, chunk);
+		used += chunk;
+		src += chunk;
+		remaining -= chunk;
+
+		if(remaining == 0) break;
+
+		if(!writeSectors(sector, used / RingSectorSize)) return false;
+		sector += used / RingSectorSize;
+		used = 0;
+	}
+
+	const size_t count = (used + RingSectorSize - 1) / RingSectorSize;
+	memset(staging + used, 0, count * RingSectorSize - used);
+	if(!writeSectors(sector, count)) return false;
+
+	head += sectors;
+	sequence++;
+
+	if(millis() - lastCheckpoint >= CONFIG_RING_LOG_CHECKPOINT_S * 1000ULL){
+		checkpoint();
+	}
+
+	return true;
+}
+
+bool RingLog::readHeader(uint32_t sector, RingRecordHeader& header){
+	if(sector >= superblock.dataSectors || !readSector(RingDataStart + sector)) return false;
+
+	memcpy(&header, staging, sizeof(header));
+	return memcmp(header.magic, RingRecordMagic, 4) == 0 && header.ringId == superblock.ringId &&
+		   header.headerCrc == ringCrc32(&header, offsetof(RingRecordHeader, headerCrc)) &&
+		   sector + ringSectors(header.size) <= superblock.dataSectors;
+}
+
+bool RingLog::readSector(uint32_t sector){
+	const esp_err_t err = sdmmc_read_sectors(card, staging, partitionStart + sector, 1);
+	if(err != ESP_OK){
+		ESP_LOGE(TAG, "error reading sector %" PRIu32 " (%s)", partitionStart + sector, esp_err_to_name(err));
+		return false;
+	}
+	return true;
+}
+
+//The SD drivers serialise single transactions, so this can run alongside FATFS writing its own partition
+bool RingLog::writeSectors(uint32_t sector, size_t count){
+	const esp_err_t err = sdmmc_write_sectors(card, staging, partitionStart + sector, count);
+	if(err != ESP_OK){
+		ESP_LOGE(TAG, "error writing %zu sectors at %" PRIu32 " (%s)", count, partitionStart + sector, esp_err_to_name(err));
+		return false;
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef THUNDER_DETECTOR_RINGLOG_H
+#define THUNDER_DETECTOR_RINGLOG_H
+
+#include <sdkconfig.h>
+#include "SensorEvent.hpp"
+#include "Fusion.h"
+
+#ifdef CONFIG_RING_LOG
+
+#include "RingLogFormat.h"
+#include <sdmmc_cmd.h>
+#include <mutex>
+
+/**
+ * Circular log of raw sectors in a dedicated SD partition, see RingLogFormat.h.
+ * Records go straight to the card with sdmmc_write_sectors, without FAT, so a write costs the same every
+ * time - proportional to its size, with no directory or allocation table updates in between.
+ * Writes are synchronous and serialised, call them from the task that produced the data.
+ */
+class RingLog {
+public:
+	/**
+	 * Finds the ring partition in the card's MBR, formats it if it has no superblock and recovers the head.
+	 * @param card mounted card, FAT keeps using its own partition
+	 */
+	static bool start(sdmmc_card_t* card);
+
+	//8-bit grayscale frame
+	static bool frame(uint64_t timestamp, const uint8_t* pixels, uint16_t width, uint16_t height);
+
+	//Mono PCM window, 'timestamp' of its first sample
+	static bool audio(uint64_t timestamp, const int16_t* samples, size_t count, uint32_t sampleRate);
+
+	static bool event(const SensorEvent& event);
+	static bool strike(const Fusion::Strike& strike);
+
+private:
+	static sdmmc_card_t* card;
+	static uint32_t partitionStart; //[sectors] on the card
+	static RingSuperblock superblock;
+
+	static std::mutex mutex;
+	static uint8_t* staging; //DMA-capable, whole sectors
+	static uint64_t sequence;
+	static uint32_t head;
+	static uint32_t boot;
+	static uint32_t checkpoints;
+	static uint64_t lastCheckpoint; //[ms]
+
+	static bool findPartition();
+	static bool format();
+	static void recover();
+	static bool checkpoint();
+
+	static bool write(RingRecordHeader& header, const void* payload);
+	static bool readHeader(uint32_t sector, RingRecordHeader& header);
+	static bool readSector(uint32_t sector);
+	static bool writeSectors(uint32_t sector, size_t count);
+};
+
+#else
+
+class RingLog {
+public:
+	static bool start(void*){ return false; }
+	static bool frame(uint64_t, const uint8_t*, uint16_t, uint16_t){ return false; }
+	static bool audio(uint64_t, const int16_t*, size_t, uint32_t){ return false; }
+	static bool event(const SensorEvent&){ return false; }
+	static bool strike(const Fusion::Strike&){ return false; }
+};
+
+#endif
+
+#endif //THUNDER_DETECTOR_RINGLOG_H
@@ -0,0 +1,110 @@
+#ifndef THUNDER_DETECTOR_RINGLOGFORMAT_H
+#define THUNDER_DETECTOR_RINGLOGFORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+
+//Raw sector ring format, shared between the firmware (RingLog) and host/tools/ringextract.
+//The ring is an MBR partition of type RingPartitionType. Sector 0 of it holds the RingSuperblock, sectors 1
+//and 2 alternate RingCheckpoints, the rest is the data area. Every record starts on a sector boundary with a
+//RingRecordHeader followed directly by its payload, padded to whole sectors. A record that doesn't fit before
+//the end of the data area goes to its start, overwriting the oldest records.
+
+static constexpr uint8_t RingPartitionType = 0xDA; //"non-FS data"
+static constexpr size_t RingSectorSize = 512;
+static constexpr uint32_t RingDataStart = 3; //[sectors] from the partition start
+
+struct RingSuperblock {
+	char magic[4]; //"THRS"
+	uint16_t version;
+	uint16_t sectorSize;
+	uint32_t ringId; //random, chosen when the ring is formatted
+	uint32_t dataSectors;
+	uint32_t crc; //ringCrc32() of the fields above
+};
+
+//Where the next record goes, written every CONFIG_RING_LOG_CHECKPOINT_S. After a reboot the writer follows
+//the records from the newer checkpoint to find the actual head.
+struct RingCheckpoint {
+	char magic[4]; //"THRC"
+	uint32_t ringId;
+	uint64_t sequence; //of the next record
+	uint32_t head; //[sectors] in the data area
+	uint32_t boot;
+	uint32_t crc;
+	uint32_t reserved;
+};
+
+enum class RingRecordType : uint8_t {
+	Frame, //8-bit grayscale, width x height
+	Audio, //mono int16 samples
+	Event //RingEvent
+};
+
+struct RingRecordHeader {
+	char magic[4]; //"THRR"
+	uint32_t ringId; //records from before the ring was formatted again don't match
+	uint64_t sequence; //record number since formatting, continues across boots
+	uint64_t timestamp; //[ms] since boot
+	uint32_t boot;
+	uint32_t size; //payload bytes
+	RingRecordType type;
+	uint8_t reserved[3];
+	uint16_t width, height; //Frame
+	uint32_t sampleRate; //Audio
+	uint32_t payloadCrc; //ringCrc32() of the payload
+	uint32_t headerCrc; //ringCrc32() of the header up to this field
+};
+static_assert(sizeof(RingRecordHeader) == 56);
+
+enum class RingEventType : uint8_t {
+	Video,
+	Audio,
+	Strike
+};
+
+struct RingEvent {
+	uint64_t audioTimestamp; //Strike: [ms] of the thunder, header timestamp is the flash
+	float distance; //Strike: [m]
+	RingEventType type;
+	uint8_t value; //Video: intensity, Audio: ThunderType
+	uint16_t reserved;
+};
+static_assert(sizeof(RingEvent) == 16);
+
+static constexpr char RingSuperblockMagic[4] = { 'T', 'H', 'R', 'S' };
+static constexpr char RingCheckpointMagic[4] = { 'T', 'H', 'R', 'C' };
+static constexpr char RingRecordMagic[4] = { 'T', 'H', 'R', 'R' };
+static constexpr uint16_t RingVersion = 1;
+
+inline constexpr uint32_t ringSectors(size_t payload){
+	return (sizeof(RingRecordHeader) + payload + RingSectorSize - 1) / RingSectorSize;
+}
+
+struct RingCrcTable {
+	uint32_t entries[256];
+
+	constexpr RingCrcTable() : entries(){
+		for(uint32_t i = 0; i < 256; i++){
+			uint32_t c = i;
+			for(int bit = 0; bit < 8; bit++){
+				c = (c & 1) ? (c >> 1) ^ 0xEDB88320 : c >> 1;
+			}
+			entries[i] = c;
+		}
+	}
+};
+
+static constexpr RingCrcTable RingCrc;
+
+//CRC-32 (as zlib), 'crc' continues a previous call
+inline uint32_t ringCrc32(const void* data, size_t size, uint32_t crc = 0){
+	const auto* bytes = (const uint8_t*) data;
+	crc = ~crc;
+	for(size_t i = 0; i < size; i++){
+		crc = RingCrc.entries[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+#endif //THUNDER_DETECTOR_RINGLOGFORMAT_H
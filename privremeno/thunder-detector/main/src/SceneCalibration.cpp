@@ -0,0 +1,44 @@
+#include "SceneCalibration.h"
+
+static constexpr const char* SceneNames[] = { "day", "dusk", "night" };
+static_assert(sizeof(SceneNames) / sizeof(SceneNames[0]) == (size_t) SceneCalibration::Scene::Count);
+
+bool SceneCalibration::update(float level, float noise){
+	if(this->level < 0){
+		this->level = level;
+		this->noise = noise;
+	}else{
+		this->level += (level - this->level) * Weight;
+		this->noise += (noise - this->noise) * Weight;
+	}
+
+	const Scene next = classify();
+	if(next == scene){
+		held = 0;
+		return false;
+	}
+
+	if(next != candidate){
+		candidate = next;
+		held = 0;
+	}
+	if(++held < HoldFrames) return false;
+
+	scene = next;
+	held = 0;
+	return true;
+}
+
+SceneCalibration::Scene SceneCalibration::classify() const{
+	//the boundaries of the current scene are moved out, leaving it takes a clear change
+	const float night = scene == Scene::Night ? NightLevel * Hysteresis : (scene == Scene::Day ? NightLevel : NightLevel / Hysteresis);
+	const float day = scene == Scene::Day ? DayLevel / Hysteresis : DayLevel * (scene == Scene::Dusk ? Hysteresis : 1);
+
+	if(level < night) return Scene::Night;
+	if(level >= day) return Scene::Day;
+	return Scene::Dusk;
+}
+
+const char* SceneCalibration::name(Scene scene){
+	return SceneNames[(size_t) scene];
+}
@@ -0,0 +1,50 @@
+#ifndef THUNDER_DETECTOR_SCENECALIBRATION_H
+#define THUNDER_DETECTOR_SCENECALIBRATION_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Tells day, dusk and night apart by the brightness of the scene: the luminance of quiet frames divided by the
+ * exposure and gain the sensor used, since its automatic control keeps the frames about equally bright. Smoothed
+ * over a few seconds, and a new scene has to hold for HoldFrames with some hysteresis before it is switched to, so
+ * clouds or a headlight don't flip it.
+ */
+class SceneCalibration {
+public:
+	enum class Scene : uint8_t {
+		Day, Dusk, Night, Count
+	};
+
+	/**
+	 * @param level mean luminance of the frame at an exposure of the whole frame period and no gain
+	 * @param noise [gray levels] deviation of a pixel between frames
+	 * @return true when the scene switched
+	 */
+	bool update(float level, float noise);
+
+	Scene getScene() const{ return scene; }
+	float getLevel() const{ return level; }
+	float getNoise() const{ return noise; }
+
+	static const char* name(Scene scene);
+
+	static constexpr float NightLevel = 40; //a dim scene with the exposure and gain at their limits
+	static constexpr float DayLevel = 400;
+	static constexpr float Hysteresis = 1.25f; //level ratio past a boundary to cross it
+	static constexpr uint32_t HoldFrames = 100;
+
+private:
+	Scene scene = Scene::Dusk; //thresholds as configured until the scene is known
+	Scene candidate = Scene::Dusk;
+	uint32_t held = 0;
+
+	float level = -1, noise = 0; //-1 until the first frame
+
+	static constexpr float Weight = 1.0f / 32; //of a frame in the averages
+
+	Scene classify() const;
+};
+
+
+#endif //THUNDER_DETECTOR_SCENECALIBRATION_H
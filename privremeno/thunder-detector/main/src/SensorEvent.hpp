@@ -1,8 +1,18 @@
 #ifndef THUNDER_DETECTOR_SENSOREVENT_H
 #define THUNDER_DETECTOR_SENSOREVENT_H
 
+#include <cstddef>
+#include <cstdint>
+
 struct VideoEvent {
 	uint8_t intensity; //average difference between grayscale frames with and without a sudden change, (0-255]
+
+	//Shape of the change, from the connected regions of changed 4x4 pixel cells: a cloud flash lights up one large
+	//region or many at once, a headlight a single compact or elongated one
+	uint8_t regions;
+	uint8_t coverage; //share of the frame in changed cells, (0-255]
+	uint16_t left, top, right, bottom; //[px] bounding box of the largest region
+	float elongation; //major to minor axis of the largest region, 1 for a round one
 	//TODO - add direction to lightning detection model¸
 };
 
@@ -23,7 +33,7 @@ struct SensorEvent {
 	enum class Type {
 		Audio, Video
 	} type;
-	size_t timestamp; //[ms]
+	uint64_t timestamp; //[us] micros(): the flash from the camera's frame timestamps, the first sample of a clap
 
 	union {
 		VideoEvent video;
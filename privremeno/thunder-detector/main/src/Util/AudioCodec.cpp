@@ -0,0 +1,340 @@
+#include "AudioCodec.h"
+#include "BitStream.h"
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+static constexpr int16_t AdpcmSteps[89] = {
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97,
+		107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+		876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428,
+		4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+		22385, 24623, 27086, 29794, 32767
+};
+
+static constexpr int8_t AdpcmIndexSteps[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static inline int32_t clamp16(int32_t value){
+	return std::clamp<int32_t>(value, INT16_MIN, INT16_MAX);
+}
+
+//Decoder side of a 4-bit code, the encoder tracks the decoder's prediction with it
+static inline void adpcmStep(uint8_t code, int32_t& predictor, uint8_t& index){
+	const int32_t step = AdpcmSteps[index];
+
+	int32_t delta = step >> 3;
+	if(code & 4) delta += step;
+	if(code & 2) delta += step >> 1;
+	if(code & 1) delta += step >> 2;
+
+	predictor = clamp16((code & 8) ? predictor - delta : predictor + delta);
+	index = std::clamp<int>(index + AdpcmIndexSteps[code & 7], 0, 88);
+}
+
+static inline uint8_t adpcmCode(int32_t sample, int32_t& predictor, uint8_t& index){
+	int32_t diff = sample - predictor;
+	uint8_t code = 0;
+	if(diff < 0){
+		code = 8;
+		diff = -diff;
+	}
+
+	int32_t step = AdpcmSteps[index];
+	if(diff >= step){
+		code |= 4;
+		diff -= step;
+	}
+	step >>= 1;
+	if(diff >= step){
+		code |= 2;
+		diff -= step;
+	}
+	step >>= 1;
+	if(diff >= step){
+		code |= 1;
+	}
+
+	adpcmStep(code, predictor, index);
+	return code;
+}
+
+static inline int32_t predict(const int16_t* x, uint8_t order){
+	switch(order){
+		case 1:
+			return x[-1];
+		case 2:
+			return 2 * x[-1] - x[-2];
+		case 3:
+			return 3 * x[-1] - 3 * x[-2] + x[-3];
+		case 4:
+			return 4 * x[-1] - 6 * x[-2] + 4 * x[-3] - x[-4];
+		default:
+			return 0;
+	}
+}
+
+AudioEncoder::AudioEncoder(AudioCodec codec) : codec(codec){
+	blockSamples = codec == AudioCodec::ImaAdpcm ? AdpcmBlockSamples : LosslessBlockSamples;
+}
+
+size_t AudioEncoder::headerSize() const{
+	//RIFF + fmt (16 B for PCM, 20 with samples per block) + fact for the compressed ones + data
+	return codec == AudioCodec::Pcm ? 44 : 60;
+}
+
+void AudioEncoder::header(uint8_t* out, uint32_t sampleRate, uint32_t samples, uint32_t dataSize) const{
+	const bool pcm = codec == AudioCodec::Pcm;
+
+	uint16_t format = WavFormatPcm, blockAlign = 2, bits = 16;
+	uint32_t byteRate = sampleRate * 2;
+	if(codec == AudioCodec::ImaAdpcm){
+		format = WavFormatImaAdpcm;
+		blockAlign = AdpcmBlockBytes;
+		bits = 4;
+		byteRate = sampleRate * AdpcmBlockBytes / AdpcmBlockSamples;
+	}else if(codec == AudioCodec::Lossless){
+		format = WavFormatLossless; //blocks vary in size, the rest describes the decoded audio
+	}
+
+	const uint32_t fmtSize = pcm ? 16 : 20, riffSize = headerSize() - 8 + dataSize, factSize = 4;
+	const uint16_t channels = 1, extraSize = 2, blockSamples = this->blockSamples;
+
+	size_t pos = 0;
+	const auto put = [&](const void* data, size_t size){
+		memcpy(out + pos, data, size);
+		pos += size;
+	};
+
+	put("RIFF", 4);
+	put(&riffSize, 4);
+	put("WAVEfmt ", 8);
+	put(&fmtSize, 4);
+	put(&format, 2);
+	put(&channels, 2);
+	put(&sampleRate, 4);
+	put(&byteRate, 4);
+	put(&blockAlign, 2);
+	put(&bits, 2);
+	if(!pcm){
+		put(&extraSize, 2);
+		put(&blockSamples, 2);
+		put("fact", 4);
+		put(&factSize, 4);
+		put(&samples, 4);
+	}
+	put("data", 4);
+	put(&dataSize, 4);
+}
+
+size_t AudioEncoder::maxOutput(size_t count) const{
+	if(codec == AudioCodec::Pcm) return count * sizeof(int16_t);
+
+	//the buffered remainder adds at most one block
+	const size_t blocks = (count + blockSamples - 1) / blockSamples + 1;
+	return blocks * (codec == AudioCodec::ImaAdpcm ? AdpcmBlockBytes : LosslessMaxBlockBytes);
+}
+
+size_t AudioEncoder::encode(const int16_t* samples, size_t count, uint8_t* out){
+	if(codec == AudioCodec::Pcm){
+		memcpy(out, samples, count * sizeof(int16_t));
+		return count * sizeof(int16_t);
+	}
+
+	size_t size = 0;
+
+	if(buffered > 0){
+		const size_t n = std::min(count, blockSamples - buffered);
+		memcpy(block + buffered, samples, n * sizeof(int16_t));
+		buffered += n;
+		samples += n;
+		count -= n;
+
+		if(buffered < blockSamples) return 0;
+		size += encodeBlock(block, blockSamples, out);
+		buffered = 0;
+	}
+
+	//whole blocks straight from the input
+	for(; count >= blockSamples; samples += blockSamples, count -= blockSamples){
+		size += encodeBlock(samples, blockSamples, out + size);
+	}
+
+	memcpy(block, samples, count * sizeof(int16_t));
+	buffered = count;
+	return size;
+}
+
+size_t AudioEncoder::flush(uint8_t* out){
+	if(buffered == 0) return 0;
+
+	if(codec == AudioCodec::ImaAdpcm){
+		std::fill(block + buffered, block + blockSamples, block[buffered - 1]);
+	}
+
+	const size_t size = encodeBlock(block, codec == AudioCodec::ImaAdpcm ? blockSamples : buffered, out);
+	buffered = 0;
+	return size;
+}
+
+void AudioEncoder::reset(){
+	buffered = 0;
+	adpcmIndex = 0;
+}
+
+size_t AudioEncoder::encodeBlock(const int16_t* samples, size_t count, uint8_t* out){
+	return codec == AudioCodec::ImaAdpcm ? encodeAdpcm(samples, out) : encodeLossless(samples, count, out);
+}
+
+size_t AudioEncoder::encodeAdpcm(const int16_t* samples, uint8_t* out){
+	//block header: first sample verbatim, the step index, a reserved byte
+	int32_t predictor = samples[0];
+	memcpy(out, &samples[0], 2);
+	out[2] = adpcmIndex;
+	out[3] = 0;
+
+	//two codes per byte, the earlier one in the low nibble
+	for(size_t i = 1; i < AdpcmBlockSamples; i += 2){
+		const uint8_t low = adpcmCode(samples[i], predictor, adpcmIndex);
+		const uint8_t high = adpcmCode(samples[i + 1], predictor, adpcmIndex);
+		out[4 + i / 2] = low | (high << 4);
+	}
+
+	return AdpcmBlockBytes;
+}
+
+size_t AudioEncoder::encodeLossless(const int16_t* x, size_t count, uint8_t* out){
+	LosslessBlockHeader header = { (uint16_t) count, (uint16_t) (sizeof(LosslessBlockHeader) + count * sizeof(int16_t)), LosslessVerbatim, 0 };
+
+	if(count > 2 * LosslessMaxOrder){
+		//sum of absolute residuals of every fixed predictor, the smallest one picks the order
+		uint32_t sums[LosslessMaxOrder + 1] = {};
+		for(size_t i = LosslessMaxOrder; i < count; i++){
+			const int32_t e0 = x[i];
+			const int32_t e1 = e0 - x[i - 1];
+			const int32_t e2 = e1 - (x[i - 1] - x[i - 2]);
+			const int32_t e3 = e2 - (x[i - 1] - 2 * x[i - 2] + x[i - 3]);
+			const int32_t e4 = e3 - (x[i - 1] - 3 * x[i - 2] + 3 * x[i - 3] - x[i - 4]);
+			sums[0] += std::abs(e0);
+			sums[1] += std::abs(e1);
+			sums[2] += std::abs(e2);
+			sums[3] += std::abs(e3);
+			sums[4] += std::abs(e4);
+		}
+		const uint8_t order = std::min_element(sums, sums + LosslessMaxOrder + 1) - sums;
+
+		uint64_t sum = 0;
+		for(size_t i = order; i < count; i++){
+			const int32_t e = x[i] - predict(x + i, order);
+			residuals[i] = ((uint32_t) e << 1) ^ (uint32_t) (e >> 31);
+			sum += residuals[i];
+		}
+
+		//Rice parameter around log2 of the mean residual, then the exact size it gives
+		const size_t n = count - order;
+		uint8_t rice = 0;
+		while(rice < 20 && ((uint64_t) n << (rice + 1)) < sum){
+			rice++;
+		}
+
+		uint64_t bits = (uint64_t) n * (rice + 1);
+		for(size_t i = order; i < count; i++){
+			bits += residuals[i] >> rice;
+		}
+
+		const size_t size = sizeof(LosslessBlockHeader) + order * sizeof(int16_t) + (bits + 7) / 8;
+		if(size < header.size){
+			header = { (uint16_t) count, (uint16_t) size, order, rice };
+			memcpy(out, &header, sizeof(header));
+			memcpy(out + sizeof(header), x, order * sizeof(int16_t));
+
+			BitWriter writer(out + sizeof(header) + order * sizeof(int16_t));
+			const uint32_t mask = (1u << rice) - 1;
+			for(size_t i = order; i < count; i++){
+				const uint32_t u = residuals[i];
+				writer.zeros(u >> rice);
+				writer.put((1u << rice) | (u & mask), rice + 1);
+			}
+			writer.finish();
+			return size;
+		}
+	}
+
+	//noise or too short: plain samples
+	memcpy(out, &header, sizeof(header));
+	memcpy(out + sizeof(header), x, count * sizeof(int16_t));
+	return header.size;
+}
+
+AudioDecoder::AudioDecoder(AudioCodec codec) : codec(codec){}
+
+size_t AudioDecoder::maxBlockSamples() const{
+	return codec == AudioCodec::ImaAdpcm ? AdpcmBlockSamples : LosslessBlockSamples;
+}
+
+size_t AudioDecoder::blockSize(const uint8_t* header) const{
+	if(codec == AudioCodec::ImaAdpcm){
+		return header[2] <= 88 ? AdpcmBlockBytes : 0;
+	}
+	if(codec != AudioCodec::Lossless) return 0;
+
+	LosslessBlockHeader block;
+	memcpy(&block, header, BlockHeaderBytes);
+	if(block.samples == 0 || block.samples > LosslessBlockSamples || block.size < sizeof(LosslessBlockHeader) ||
+	   block.size > LosslessMaxBlockBytes) return 0;
+	return block.size;
+}
+
+size_t AudioDecoder::decode(const uint8_t* data, size_t size, int16_t* out) const{
+	if(size < sizeof(LosslessBlockHeader) || blockSize(data) != size) return 0;
+	return codec == AudioCodec::ImaAdpcm ? decodeAdpcm(data, out) : decodeLossless(data, size, out);
+}
+
+size_t AudioDecoder::decodeAdpcm(const uint8_t* data, int16_t* out) const{
+	int16_t first;
+	memcpy(&first, data, 2);
+	int32_t predictor = first;
+	uint8_t index = data[2];
+
+	out[0] = first;
+	for(size_t i = 1; i < AdpcmBlockSamples; i += 2){
+		const uint8_t byte = data[4 + i / 2];
+		adpcmStep(byte & 0x0F, predictor, index);
+		out[i] = predictor;
+		adpcmStep(byte >> 4, predictor, index);
+		out[i + 1] = predictor;
+	}
+
+	return AdpcmBlockSamples;
+}
+
+size_t AudioDecoder::decodeLossless(const uint8_t* data, size_t size, int16_t* out) const{
+	LosslessBlockHeader header;
+	memcpy(&header, data, sizeof(header));
+	data += sizeof(header);
+	size -= sizeof(header);
+
+	if(header.order == LosslessVerbatim){
+		if(size != header.samples * sizeof(int16_t)) return 0;
+		memcpy(out, data, size);
+		return header.samples;
+	}
+
+	if(header.order > LosslessMaxOrder || header.order >= header.samples || header.rice > 20 ||
+	   size < header.order * sizeof(int16_t)) return 0;
+
+	memcpy(out, data, header.order * sizeof(int16_t));
+	BitReader reader(data + header.order * sizeof(int16_t), size - header.order * sizeof(int16_t));
+
+	for(size_t i = header.order; i < header.samples; i++){
+		uint32_t quotient = 0;
+		while(!reader.bit()){
+			if(++quotient > (1u << 22)) return 0;
+		}
+
+		const uint32_t u = (quotient << header.rice) | reader.get(header.rice);
+		const int32_t e = (int32_t) (u >> 1) ^ -(int32_t) (u & 1);
+		out[i] = (int16_t) (predict(out + i, header.order) + e);
+	}
+
+	return reader.overrun ? 0 : header.samples;
+}
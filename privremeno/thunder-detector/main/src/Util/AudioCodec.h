@@ -0,0 +1,121 @@
+#ifndef THUNDER_DETECTOR_AUDIOCODEC_H
+#define THUNDER_DETECTOR_AUDIOCODEC_H
+
+#include <cstdint>
+#include <cstddef>
+
+//16-bit mono audio coding for recordings, shared between the firmware and the host tools. Audio is coded
+//in independent blocks in the data chunk of a WAV file:
+// - ImaAdpcm: standard WAV IMA ADPCM (format 0x0011), 4 bits per sample, about 4:1, plays in common players
+// - Lossless: per block the best of the fixed polynomial predictors of order 0-4 (as FLAC's FIXED subframes),
+//   residuals Rice coded, under WAVE_FORMAT_DEVELOPMENT (0xFFFF) so players refuse it instead of playing noise
+//Everything is integer arithmetic, the inner loops are straight-line and branch free where it matters.
+
+enum class AudioCodec : uint8_t {
+	Pcm,
+	ImaAdpcm,
+	Lossless
+};
+
+static constexpr uint16_t WavFormatPcm = 0x0001;
+static constexpr uint16_t WavFormatImaAdpcm = 0x0011;
+static constexpr uint16_t WavFormatLossless = 0xFFFF;
+
+static constexpr size_t AdpcmBlockBytes = 256; //WAV blockAlign
+static constexpr size_t AdpcmBlockSamples = (AdpcmBlockBytes - 4) * 2 + 1; //the header holds the first sample
+
+//Lossless block: LosslessBlockHeader, 'order' warm-up samples, Rice coded residuals padded to a byte
+static constexpr size_t LosslessBlockSamples = 1024;
+static constexpr uint8_t LosslessMaxOrder = 4;
+static constexpr uint8_t LosslessVerbatim = 0xFF; //order of a block stored as plain samples
+
+struct LosslessBlockHeader {
+	uint16_t samples;
+	uint16_t size; //[B] of the whole block, including this header
+	uint8_t order;
+	uint8_t rice; //Rice parameter
+};
+static_assert(sizeof(LosslessBlockHeader) == 6);
+
+static constexpr size_t LosslessMaxBlockBytes = sizeof(LosslessBlockHeader) + LosslessBlockSamples * sizeof(int16_t);
+
+/**
+ * Streaming encoder into one of the AudioCodec formats. Samples are buffered up to a whole block, so
+ * encode() can be fed any amount and flush() codes the remainder at the end of a file.
+ */
+class AudioEncoder {
+public:
+	explicit AudioEncoder(AudioCodec codec);
+
+	//Bytes of the WAV header written by header(), fixed per codec so the header can be patched in place
+	size_t headerSize() const;
+
+	/**
+	 * WAV header for a file of 'samples' samples, coded into 'dataSize' bytes.
+	 * @param out headerSize() bytes
+	 */
+	void header(uint8_t* out, uint32_t sampleRate, uint32_t samples, uint32_t dataSize) const;
+
+	//Upper bound of what encode() followed by flush() writes for 'count' samples
+	size_t maxOutput(size_t count) const;
+
+	/**
+	 * Codes all complete blocks, the rest stays buffered for the next call.
+	 * @param out at least maxOutput(count) bytes
+	 * @return bytes written to 'out'
+	 */
+	size_t encode(const int16_t* samples, size_t count, uint8_t* out);
+
+	//Codes the buffered samples as the last block of a file, an ADPCM block is padded with the last sample
+	size_t flush(uint8_t* out);
+
+	//Starts a new file
+	void reset();
+
+private:
+	const AudioCodec codec;
+
+	int16_t block[LosslessBlockSamples];
+	size_t buffered = 0;
+	size_t blockSamples;
+
+	uint8_t adpcmIndex = 0; //step index carries over from block to block
+	uint32_t residuals[LosslessBlockSamples]; //zigzag coded
+
+	size_t encodeBlock(const int16_t* samples, size_t count, uint8_t* out);
+	size_t encodeAdpcm(const int16_t* samples, uint8_t* out);
+	size_t encodeLossless(const int16_t* samples, size_t count, uint8_t* out);
+};
+
+/**
+ * Block decoder for the AudioCodec formats.
+ */
+class AudioDecoder {
+public:
+	AudioDecoder(AudioCodec codec);
+
+	//Bytes of a block needed by blockSize()
+	static constexpr size_t BlockHeaderBytes = 4;
+
+	//Samples a block decodes into at most
+	size_t maxBlockSamples() const;
+
+	//Size of the block starting with 'header', 0 if it can't be the start of a block
+	size_t blockSize(const uint8_t* header) const;
+
+	/**
+	 * Decodes one block.
+	 * @param size blockSize() of it
+	 * @param out maxBlockSamples() samples
+	 * @return decoded samples, 0 if the block is corrupt
+	 */
+	size_t decode(const uint8_t* data, size_t size, int16_t* out) const;
+
+private:
+	const AudioCodec codec;
+
+	size_t decodeAdpcm(const uint8_t* data, int16_t* out) const;
+	size_t decodeLossless(const uint8_t* data, size_t size, int16_t* out) const;
+};
+
+#endif //THUNDER_DETECTOR_AUDIOCODEC_H
@@ -0,0 +1,105 @@
+#ifndef THUNDER_DETECTOR_BITSTREAM_H
+#define THUNDER_DETECTOR_BITSTREAM_H
+
+#include <cstdint>
+#include <cstddef>
+
+//MSB-first bit packing for the entropy coders in AudioCodec and FrameCodec
+
+class BitWriter {
+public:
+	BitWriter(uint8_t* out) : out(out){}
+
+	//'bits' <= 32
+	void put(uint32_t value, uint32_t bits){
+		acc = (acc << bits) | value;
+		count += bits;
+		while(count >= 8){
+			count -= 8;
+			out[size++] = acc >> count;
+		}
+	}
+
+	void zeros(uint32_t bits){
+		for(; bits > 32; bits -= 32){
+			put(0, 32);
+		}
+		put(0, bits);
+	}
+
+	//Exp-Golomb of order 0, 'value' < 2^31
+	void expGolomb(uint32_t value){
+		const uint32_t bits = 32 - __builtin_clz(value + 1);
+		zeros(bits - 1);
+		put(value + 1, bits);
+	}
+
+	//Complete bytes written so far
+	size_t bytes() const{
+		return size;
+	}
+
+	//Pads the last byte, returns the bytes written
+	size_t finish(){
+		if(count > 0){
+			put(0, 8 - count);
+		}
+		return size;
+	}
+
+private:
+	uint8_t* out;
+	size_t size = 0;
+	uint64_t acc = 0;
+	uint32_t count = 0;
+};
+
+class BitReader {
+public:
+	BitReader(const uint8_t* data, size_t size) : data(data), size(size){}
+
+	uint32_t bit(){
+		if(count == 0){
+			if(pos >= size){
+				overrun = true;
+				return 1; //ends unary runs
+			}
+			acc = data[pos++];
+			count = 8;
+		}
+		return (acc >> --count) & 1;
+	}
+
+	uint32_t get(uint32_t bits){
+		uint32_t value = 0;
+		while(bits--){
+			value = (value << 1) | bit();
+		}
+		return value;
+	}
+
+	//Leading zeros up to the next one bit, at most 'max'
+	uint32_t zeros(uint32_t max){
+		uint32_t n = 0;
+		while(n < max && !bit()){
+			n++;
+		}
+		return n;
+	}
+
+	uint32_t expGolomb(){
+		const uint32_t bits = zeros(31);
+		return ((1u << bits) | get(bits)) - 1;
+	}
+
+	bool overrun = false;
+
+private:
+	const uint8_t* data;
+	size_t size;
+	size_t pos = 0;
+	uint32_t acc = 0;
+	uint32_t count = 0;
+};
+
+#endif //THUNDER_DETECTOR_BITSTREAM_H
@@ -0,0 +1,124 @@
+#include "ComponentLabeller.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+size_t ComponentLabeller::label(const ImageView& mask){
+	const uint16_t width = std::min<size_t>(mask.width, MaxWidth);
+	memset(labels, 0, sizeof(labels));
+	nextLabel = 1;
+	overflow = false;
+	foundCount = 0;
+
+	for(uint16_t y = 0; y < mask.height; y++){
+		const uint8_t* row = mask.row(y);
+		const uint8_t* above = labels[(y + 1) & 1];
+		uint8_t* current = labels[y & 1];
+
+		for(uint16_t x = 0; x < width; x++){
+			if(!row[x]){
+				current[x] = 0;
+				continue;
+			}
+
+			//the neighbours already visited: west, and the three above
+			uint8_t label = x > 0 ? current[x - 1] : 0;
+			const uint8_t north[] = { x > 0 ? above[x - 1] : (uint8_t) 0, above[x], x + 1 < width ? above[x + 1] : (uint8_t) 0 };
+			for(const uint8_t neighbour : north){
+				if(!neighbour) continue;
+				label = label ? unite(label, neighbour) : neighbour;
+			}
+
+			if(!label){
+				if(nextLabel >= MaxLabels){
+					overflow = true;
+					current[x] = 0;
+					continue;
+				}
+				label = nextLabel++;
+				parent[label] = label;
+				moments[label] = { 0, 0, 0, 0, 0, 0, x, y, x, y };
+			}
+
+			current[x] = label;
+			add(label, x, y);
+		}
+	}
+
+	//roots are the smallest labels of their sets, so going down every label is merged before its root is reached
+	size_t regions = 0;
+	for(uint8_t label = nextLabel - 1; label > 0; label--){
+		const uint8_t root = find(label);
+		if(root != label){
+			merge(moments[root], moments[label]);
+		}else{
+			regions++;
+			keep(moments[label]);
+		}
+	}
+
+	return regions;
+}
+
+uint8_t ComponentLabeller::find(uint8_t label) const{
+	while(parent[label] != label){
+		label = parent[label];
+	}
+	return label;
+}
+
+uint8_t ComponentLabeller::unite(uint8_t a, uint8_t b){
+	a = find(a);
+	b = find(b);
+	if(a > b) std::swap(a, b);
+	parent[b] = a;
+	return a;
+}
+
+void ComponentLabeller::add(uint8_t label, uint16_t x, uint16_t y){
+	Moments& m = moments[label];
+	m.area++;
+	m.sumX += x;
+	m.sumY += y;
+	m.sumXX += x * x;
+	m.sumYY += y * y;
+	m.sumXY += x * y;
+	m.left = std::min(m.left, x);
+	m.right = std::max(m.right, x);
+	m.top = std::min(m.top, y);
+	m.bottom = std::max(m.bottom, y);
+}
+
+void ComponentLabeller::merge(Moments& into, const Moments& from){
+	into.area += from.area;
+	into.sumX += from.sumX;
+	into.sumY += from.sumY;
+	into.sumXX += from.sumXX;
+	into.sumYY += from.sumYY;
+	into.sumXY += from.sumXY;
+	into.left = std::min(into.left, from.left);
+	into.right = std::max(into.right, from.right);
+	into.top = std::min(into.top, from.top);
+	into.bottom = std::max(into.bottom, from.bottom);
+}
+
+void ComponentLabeller::keep(const Moments& region){
+	size_t at = foundCount;
+	while(at > 0 && found[at - 1].area < region.area){
+		at--;
+	}
+	if(at >= MaxComponents) return;
+
+	//covariance of the pixel positions, every pixel a unit square (variance 1/12) so a line has a minor axis
+	const float n = region.area, meanX = region.sumX / n, meanY = region.sumY / n;
+	const float xx = region.sumXX / n - meanX * meanX + 1.0f / 12;
+	const float yy = region.sumYY / n - meanY * meanY + 1.0f / 12;
+	const float xy = region.sumXY / n - meanX * meanY;
+	const float half = (xx + yy) / 2, spread = std::sqrt((xx - yy) * (xx - yy) / 4 + xy * xy);
+	const float minor = std::max(half - spread, 1.0f / 12);
+
+	const size_t kept = std::min(foundCount + 1, MaxComponents);
+	std::move_backward(found + at, found + kept - 1, found + kept);
+	found[at] = { (uint16_t) region.area, region.left, region.top, region.right, region.bottom, std::sqrt((half + spread) / minor) };
+	foundCount = kept;
+}
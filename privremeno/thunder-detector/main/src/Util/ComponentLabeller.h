@@ -0,0 +1,60 @@
+#ifndef THUNDER_DETECTOR_COMPONENTLABELLER_H
+#define THUNDER_DETECTOR_COMPONENTLABELLER_H
+
+#include "Image.h"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Connected regions of a binary mask (nonzero pixels, 8-connected) in a single raster pass with union-find. Only
+ * two rows of labels and a fixed table of labels are kept, nothing is allocated: masks wider than MaxWidth are
+ * cut, and once MaxLabels run out new regions are left out (overflowed()).
+ */
+class ComponentLabeller {
+public:
+	struct Component {
+		uint16_t area; //[pixels]
+		uint16_t left, top, right, bottom; //bounding box, inclusive
+		float elongation; //major to minor axis of the region's second moments, 1 for a disc or a square
+	};
+
+	static constexpr size_t MaxWidth = 64;
+	static constexpr size_t MaxLabels = 128;
+	static constexpr size_t MaxComponents = 8; //kept, largest first
+
+	/**
+	 * @return number of regions found, the largest MaxComponents of them are in components()
+	 */
+	size_t label(const ImageView& mask);
+
+	const Component* components() const{ return found; }
+	size_t size() const{ return foundCount; }
+
+	//Some regions weren't labelled, the mask was too fragmented
+	bool overflowed() const{ return overflow; }
+
+private:
+	//Gathered per provisional label, merged into the root at the end
+	struct Moments {
+		uint32_t area, sumX, sumY, sumXX, sumYY, sumXY;
+		uint16_t left, top, right, bottom;
+	};
+
+	uint8_t parent[MaxLabels]; //0 is the background, a root is its own parent and the smallest label of its set
+	Moments moments[MaxLabels];
+	uint8_t labels[2][MaxWidth]; //the previous and the current row
+	uint8_t nextLabel = 1;
+	bool overflow = false;
+
+	Component found[MaxComponents];
+	size_t foundCount = 0;
+
+	uint8_t find(uint8_t label) const;
+	uint8_t unite(uint8_t a, uint8_t b);
+	void add(uint8_t label, uint16_t x, uint16_t y);
+	void merge(Moments& into, const Moments& from);
+	void keep(const Moments& region);
+};
+
+
+#endif //THUNDER_DETECTOR_COMPONENTLABELLER_H
@@ -0,0 +1,151 @@
+#include "DeferredLog.h"
+
+#ifdef CONFIG_DEFERRED_LOG
+
+#include "Threaded.h"
+#include "Timer.h"
+#include <esp_timer.h>
+#include <cstdio>
+#include <algorithm>
+
+#ifdef CONFIG_DEFERRED_LOG_SD
+#include "Periph/SDWriter.h"
+#endif
+
+static const char* TAG = "DeferredLog";
+
+static constexpr uint32_t DrainPeriod = 50; //[ms]
+static constexpr size_t MaxStrings = 128; //distinct format strings, tags and %s arguments written to SD
+
+DeferredLog::Buffer DeferredLog::buffers[portNUM_PROCESSORS] = {};
+
+#ifdef CONFIG_DEFERRED_LOG_SD
+static SDWriter* file = nullptr;
+static const char* defined[MaxStrings] = {};
+#endif
+
+void DeferredLog::start(){
+#ifdef CONFIG_DEFERRED_LOG_SD
+	file = new SDWriter(4096);
+	if(!file->open("/sd/log.bin")){
+		ESP_LOGE(TAG, "error opening log file on SD!");
+	}else{
+		write(&LogHeaderDefault, sizeof(LogHeaderDefault));
+	}
+#endif
+
+	static ThreadedClosure thread(&DeferredLog::loop, "DeferredLog", 4 * 1024, 1);
+	thread.start();
+}
+
+void IRAM_ATTR DeferredLog::push(esp_log_level_t level, const char* tag, const char* fmt, const uint32_t* words, size_t count){
+	//same scheme as Trace - core-local buffer, interrupts masked only for the slot write, stamped inside the mask
+	const auto irq = portSET_INTERRUPT_MASK_FROM_ISR();
+	const auto timestamp = (uint64_t) esp_timer_get_time();
+	const auto core = xPortGetCoreID();
+	auto& buf = buffers[core];
+
+	const uint32_t head = buf.head.load(std::memory_order_relaxed);
+	auto& rec = buf.records[head & (Size - 1)];
+	rec.timestamp = timestamp;
+	rec.fmt = (uintptr_t) fmt;
+	rec.tag = (uintptr_t) tag;
+	rec.kind = LogRecord::Message;
+	rec.level = level;
+	rec.core = core;
+	rec.count = count;
+	memcpy(rec.words, words, count * sizeof(uint32_t));
+	buf.head.store(head + 1, std::memory_order_release);
+
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+}
+
+void DeferredLog::loop(){
+	vTaskDelay(pdMS_TO_TICKS(DrainPeriod));
+	drain();
+}
+
+void DeferredLog::drain(){
+	static constexpr char LevelChars[] = "NEWIDV";
+	static char text[256];
+
+	for(uint8_t core = 0; core < portNUM_PROCESSORS; core++){
+		auto& buf = buffers[core];
+
+		const uint32_t head = buf.head.load(std::memory_order_acquire);
+		if(head - buf.tail > Size){
+			printf("W (%llu) %s: %lu messages dropped on core %u\n", millis(), TAG, (unsigned long) (head - buf.tail - Size), core);
+			buf.tail = head - Size;
+		}
+
+		for(; buf.tail != head; buf.tail++){
+			const LogRecord rec = buf.records[buf.tail & (Size - 1)];
+
+			//writer lapped us while copying, the record may be torn
+			if(buf.head.load(std::memory_order_acquire) - buf.tail > Size) continue;
+
+			const auto tag = (const char*) (uintptr_t) rec.tag;
+			const auto fmt = (const char*) (uintptr_t) rec.fmt;
+
+#ifdef CONFIG_DEFERRED_LOG_SD
+			if(file){
+				define(tag);
+				define(fmt);
+			}
+#endif
+
+			formatLog(text, sizeof(text), fmt, rec.words, rec.count, sizeof(void*), [](uint64_t raw){
+				const auto str = (const char*) (uintptr_t) raw;
+#ifdef CONFIG_DEFERRED_LOG_SD
+				if(file) define(str);
+#endif
+				return str ? str : "(null)";
+			});
+
+			printf("%c (%llu) %s: %s\n", LevelChars[std::min<uint8_t>(rec.level, 5)], rec.timestamp / 1000, tag, text);
+
+#ifdef CONFIG_DEFERRED_LOG_SD
+			write(&rec, sizeof(rec));
+#endif
+		}
+	}
+
+#ifdef CONFIG_DEFERRED_LOG_SD
+	file->flush();
+#endif
+}
+
+void DeferredLog::write(const void* data, size_t size){
+#ifdef CONFIG_DEFERRED_LOG_SD
+	file->write(data, size);
+#endif
+}
+
+void DeferredLog::define(const char* str){
+#ifdef CONFIG_DEFERRED_LOG_SD
+	if(str == nullptr) return;
+
+	//open addressing on the pointer, strings are literals so their address identifies them
+	size_t i = ((uintptr_t) str >> 2) % MaxStrings;
+	for(size_t probe = 0; probe < MaxStrings; probe++, i = (i + 1) % MaxStrings){
+		if(defined[i] == str) return;
+		if(defined[i] != nullptr) continue;
+
+		defined[i] = str;
+		break;
+	}
+	//table full - strings are still defined, just repeatedly
+
+	const size_t len = strlen(str);
+	LogRecord rec{};
+	rec.timestamp = micros();
+	rec.fmt = (uintptr_t) str;
+	rec.kind = LogRecord::String;
+	rec.count = 1;
+	rec.words[0] = len;
+	write(&rec, sizeof(rec));
+	write(str, len);
+#endif
+}
+
+#endif
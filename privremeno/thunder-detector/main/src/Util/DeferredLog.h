@@ -0,0 +1,107 @@
+#ifndef THUNDER_DETECTOR_DEFERREDLOG_H
+#define THUNDER_DETECTOR_DEFERREDLOG_H
+
+#include <cstddef>
+#include <cstring>
+#include <atomic>
+#include <type_traits>
+#include <freertos/FreeRTOS.h>
+#include <esp_log.h>
+#include <sdkconfig.h>
+#include "LogFormat.h"
+
+#ifdef CONFIG_DEFERRED_LOG
+
+/**
+ * Log calls only store the format string pointer and raw argument words into a per-core ring buffer.
+ * A low-priority task renders them to the console and, optionally, appends the binary records to
+ * /sd/log.bin for host/tools/logdecode.
+ * Format strings and %s arguments must be string literals (or otherwise outlive the log call).
+ * Records are filtered like ESP_LOGx: by LOG_LOCAL_LEVEL at compile time and esp_log_level_set() per tag at run time.
+ */
+class DeferredLog {
+public:
+	static void start();
+
+	template<typename... Args>
+	static void log(esp_log_level_t level, const char* tag, const char* fmt, Args... args){
+		static_assert(words<Args...>() <= LogMaxWords, "Too many log arguments");
+		if(level > LOG_LOCAL_LEVEL || level > esp_log_level_get(tag)) return;
+
+		uint32_t w[LogMaxWords > 0 ? LogMaxWords : 1];
+		uint32_t* p = w;
+		(pack(p, args), ...);
+		push(level, tag, fmt, w, p - w);
+	}
+
+	static constexpr size_t Size = CONFIG_DEFERRED_LOG_RECORDS;
+	static_assert((Size & (Size - 1)) == 0, "CONFIG_DEFERRED_LOG_RECORDS must be a power of 2");
+
+private:
+	struct Buffer {
+		LogRecord records[Size];
+		std::atomic<uint32_t> head; //written only by the owning core
+		uint32_t tail; //read position, log task only
+	};
+
+	static Buffer buffers[portNUM_PROCESSORS];
+
+	template<typename T>
+	static constexpr size_t wordsOf(){
+		if constexpr(std::is_floating_point_v<T>) return 2;
+		else return (sizeof(T) + 3) / 4;
+	}
+
+	template<typename... Args>
+	static constexpr size_t words(){
+		return (0 + ... + wordsOf<Args>());
+	}
+
+	template<typename T>
+	static void pack(uint32_t*& w, T value){
+		if constexpr(std::is_floating_point_v<T>){
+			const double d = value;
+			memcpy(w, &d, sizeof(d));
+			w += 2;
+		}else if constexpr(std::is_pointer_v<T>){
+			const auto v = (uintptr_t) value;
+			memcpy(w, &v, sizeof(v));
+			w += sizeof(v) / 4;
+		}else if constexpr(sizeof(T) > 4){
+			const auto v = (uint64_t) value;
+			memcpy(w, &v, sizeof(v));
+			w += 2;
+		}else{
+			//sign-extended to a word, matching printf default argument promotion
+			*w++ = (uint32_t) (int32_t) value;
+		}
+	}
+
+	static void push(esp_log_level_t level, const char* tag, const char* fmt, const uint32_t* words, size_t count);
+
+	static void loop();
+	static void drain();
+	static void write(const void* data, size_t size);
+	static void define(const char* str);
+};
+
+#define DLOGE(tag, fmt, ...) DeferredLog::log(ESP_LOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define DLOGW(tag, fmt, ...) DeferredLog::log(ESP_LOG_WARN, tag, fmt, ##__VA_ARGS__)
+#define DLOGI(tag, fmt, ...) DeferredLog::log(ESP_LOG_INFO, tag, fmt, ##__VA_ARGS__)
+#define DLOGD(tag, fmt, ...) DeferredLog::log(ESP_LOG_DEBUG, tag, fmt, ##__VA_ARGS__)
+
+#else
+
+class DeferredLog {
+public:
+	static void start(){}
+};
+
+#define DLOGE(tag, fmt, ...) ESP_LOGE(tag, fmt, ##__VA_ARGS__)
+#define DLOGW(tag, fmt, ...) ESP_LOGW(tag, fmt, ##__VA_ARGS__)
+#define DLOGI(tag, fmt, ...) ESP_LOGI(tag, fmt, ##__VA_ARGS__)
+#define DLOGD(tag, fmt, ...) ESP_LOGD(tag, fmt, ##__VA_ARGS__)
+
+#endif
+
+#endif //THUNDER_DETECTOR_DEFERREDLOG_H
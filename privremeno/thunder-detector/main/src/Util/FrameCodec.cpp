@@ -0,0 +1,213 @@
+#include "FrameCodec.h"
+#include "BitStream.h"
+#include <cstring>
+#include <algorithm>
+
+static constexpr uint32_t EscapeZeros = 16; //Rice quotients from here on are sent as 8 plain bits
+static constexpr uint8_t MaxRice = 7;
+static constexpr uint8_t FirstPrediction = 128; //of the first pixel of a key frame
+
+static inline uint8_t zigzag(int32_t value){
+	return (uint8_t) ((value << 1) ^ (value >> 31));
+}
+
+static inline int32_t unzigzag(uint8_t value){
+	return (value >> 1) ^ -(int32_t) (value & 1);
+}
+
+//Quantized residual of near-lossless coding, within 'near' of 'value' once reconstructed
+static inline int32_t quantizeResidual(int32_t value, int32_t prediction, uint8_t near){
+	const int32_t error = value - prediction, step = 2 * near + 1;
+	return error >= 0 ? (error + near) / step : -((near - error) / step);
+}
+
+static inline uint8_t reconstruct(int32_t prediction, int32_t quantized, uint8_t near){
+	return std::clamp<int32_t>(prediction + quantized * (2 * near + 1), 0, 255);
+}
+
+//Key frame prediction of pixel 'i' from the already decoded pixels
+static inline uint8_t keyPrediction(const uint8_t* frame, size_t i, uint16_t width){
+	if(i == 0) return FirstPrediction;
+	return i % width == 0 ? frame[i - width] : frame[i - 1];
+}
+
+FrameEncoder::FrameEncoder(uint16_t width, uint16_t height, uint8_t near) : width(width), height(height), near(near),
+																			reference(width * height), residuals(width * height){}
+
+size_t FrameEncoder::maxOutput() const{
+	//coding stops at the raw size, one run and value (at most 56 bits) past it
+	return sizeof(FrameCodecHeader) + width * height + 16;
+}
+
+size_t FrameEncoder::encode(const uint8_t* frame, bool key, uint8_t* out){
+	key = key || !hasReference;
+	quantize(frame, key);
+	hasReference = true;
+
+	const size_t pixels = width * height;
+	const size_t size = code(key ? FrameCodecType::Key : FrameCodecType::Delta, out);
+	if(size > 0) return size;
+
+	//noise doesn't code, store the pixels
+	const FrameCodecHeader header = { FrameCodecType::Raw, near, 0, 0 };
+	memcpy(out, &header, sizeof(header));
+	memcpy(out + sizeof(header), frame, pixels);
+	memcpy(reference.data(), frame, pixels);
+	return sizeof(header) + pixels;
+}
+
+//Residuals of 'frame' into 'residuals' and its reconstruction into 'reference'. Each pixel is predicted
+//from pixels already replaced, so both can be done in place.
+void FrameEncoder::quantize(const uint8_t* frame, bool key){
+	const size_t pixels = width * height;
+	uint8_t* ref = reference.data();
+	uint8_t* res = residuals.data();
+
+	if(near == 0){
+		//modulo 256, every residual fits a byte
+		if(key){
+			res[0] = zigzag((int8_t) (frame[0] - FirstPrediction));
+			for(size_t i = 1; i < pixels; i++){
+				res[i] = zigzag((int8_t) (frame[i] - frame[i - 1]));
+			}
+			for(size_t i = width; i < pixels; i += width){
+				res[i] = zigzag((int8_t) (frame[i] - frame[i - width]));
+			}
+		}else{
+			for(size_t i = 0; i < pixels; i++){
+				res[i] = zigzag((int8_t) (frame[i] - ref[i]));
+			}
+		}
+		memcpy(ref, frame, pixels);
+		return;
+	}
+
+	for(size_t i = 0; i < pixels; i++){
+		const uint8_t prediction = key ? keyPrediction(ref, i, width) : ref[i];
+		const int32_t quantized = quantizeResidual(frame[i], prediction, near);
+		res[i] = zigzag(quantized);
+		ref[i] = reconstruct(prediction, quantized, near);
+	}
+}
+
+//Returns 0 if the frame would be larger than its pixels
+size_t FrameEncoder::code(FrameCodecType type, uint8_t* out) const{
+	const size_t pixels = width * height;
+	const uint8_t* res = residuals.data();
+
+	//Rice parameter around log2 of the mean non-zero residual
+	uint32_t sum = 0, nonZero = 0;
+	for(size_t i = 0; i < pixels; i++){
+		sum += res[i];
+		nonZero += res[i] != 0;
+	}
+	sum -= nonZero; //coded as value - 1
+	uint8_t rice = 0;
+	while(rice < MaxRice && (nonZero << (rice + 1)) < sum){
+		rice++;
+	}
+
+	const FrameCodecHeader header = { type, near, rice, 0 };
+	memcpy(out, &header, sizeof(header));
+
+	BitWriter writer(out + sizeof(header));
+	const uint32_t mask = (1u << rice) - 1;
+	uint32_t run = 0;
+
+	for(size_t i = 0; i < pixels; i++){
+		if(res[i] == 0){
+			run++;
+
+			//static areas: skip zeros four at a time
+			uint32_t word;
+			while(i + 4 < pixels){
+				memcpy(&word, res + i + 1, 4);
+				if(word != 0) break;
+				i += 4;
+				run += 4;
+			}
+			continue;
+		}
+
+		writer.expGolomb(run);
+		run = 0;
+
+		const uint32_t value = res[i] - 1;
+		if((value >> rice) < EscapeZeros){
+			writer.zeros(value >> rice);
+			writer.put((1u << rice) | (value & mask), rice + 1);
+		}else{
+			writer.zeros(EscapeZeros);
+			writer.put(value, 8);
+		}
+
+		if(writer.bytes() >= pixels) return 0;
+	}
+	if(run > 0){
+		writer.expGolomb(run);
+	}
+
+	const size_t size = writer.finish();
+	return size < pixels ? sizeof(header) + size : 0;
+}
+
+FrameDecoder::FrameDecoder(uint16_t width, uint16_t height) : width(width), height(height), frame(width * height), residuals(width * height){}
+
+const uint8_t* FrameDecoder::decode(const uint8_t* data, size_t size){
+	const size_t pixels = width * height;
+
+	FrameCodecHeader header;
+	if(size < sizeof(header)) return nullptr;
+	memcpy(&header, data, sizeof(header));
+	data += sizeof(header);
+	size -= sizeof(header);
+
+	if(header.type == FrameCodecType::Raw){
+		if(size != pixels) return nullptr;
+		memcpy(frame.data(), data, pixels);
+		hasReference = true;
+		return frame.data();
+	}
+
+	if(header.type > FrameCodecType::Raw || (header.type == FrameCodecType::Delta && !hasReference) || header.rice > MaxRice) return nullptr;
+
+	std::fill(residuals.begin(), residuals.end(), 0);
+	BitReader reader(data, size);
+
+	for(size_t i = 0; i < pixels;){
+		const uint32_t run = reader.expGolomb();
+		if(run > pixels - i) return nullptr;
+		i += run;
+		if(i == pixels) break;
+
+		const uint32_t quotient = reader.zeros(EscapeZeros);
+		const uint32_t value = quotient < EscapeZeros ? (quotient << header.rice) | reader.get(header.rice) : reader.get(8);
+		if(value > 254 || reader.overrun) return nullptr;
+		residuals[i++] = value + 1;
+	}
+	if(reader.overrun) return nullptr;
+
+	uint8_t* out = frame.data();
+	const uint8_t* res = residuals.data();
+	const bool key = header.type == FrameCodecType::Key;
+
+	if(header.near == 0){
+		if(key){
+			for(size_t i = 0; i < pixels; i++){
+				out[i] = keyPrediction(out, i, width) + unzigzag(res[i]);
+			}
+		}else{
+			for(size_t i = 0; i < pixels; i++){
+				out[i] += unzigzag(res[i]);
+			}
+		}
+	}else{
+		for(size_t i = 0; i < pixels; i++){
+			const uint8_t prediction = key ? keyPrediction(out, i, width) : out[i];
+			out[i] = reconstruct(prediction, unzigzag(res[i]), header.near);
+		}
+	}
+
+	hasReference = true;
+	return out;
+}
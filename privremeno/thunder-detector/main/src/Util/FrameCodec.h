@@ -0,0 +1,78 @@
+#ifndef THUNDER_DETECTOR_FRAMECODEC_H
+#define THUNDER_DETECTOR_FRAMECODEC_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+//8-bit grayscale frame coding for the frame log, shared between the firmware and the host tools.
+//A key frame predicts every pixel from its left neighbour (the one above in the first column), a delta frame
+//from the same pixel of the previous frame. The prediction residuals are coded as runs of zeros (Exp-Golomb)
+//between non-zero values (Rice, parameter chosen per frame). 'near' > 0 makes it near-lossless: residuals
+//are quantized so that every decoded pixel is within 'near' of the original, as in JPEG-LS.
+
+enum class FrameCodecType : uint8_t {
+	Key,
+	Delta,
+	Raw //plain pixels, when coding wouldn't make the frame smaller; a key frame too
+};
+
+struct FrameCodecHeader {
+	FrameCodecType type;
+	uint8_t near;
+	uint8_t rice; //Rice parameter of the non-zero residuals
+	uint8_t reserved;
+};
+static_assert(sizeof(FrameCodecHeader) == 4);
+
+/**
+ * Codes frames of a fixed size, each delta frame against the previous one as the decoder will see it.
+ */
+class FrameEncoder {
+public:
+	/**
+	 * @param near maximum error of a decoded pixel, 0 for lossless
+	 */
+	FrameEncoder(uint16_t width, uint16_t height, uint8_t near = 0);
+
+	//Upper bound of encode() output
+	size_t maxOutput() const;
+
+	/**
+	 * @param key code a key frame, otherwise a delta frame if there is a previous one
+	 * @param out maxOutput() bytes
+	 * @return bytes written to 'out'
+	 */
+	size_t encode(const uint8_t* frame, bool key, uint8_t* out);
+
+private:
+	const uint16_t width, height;
+	const uint8_t near;
+
+	std::vector<uint8_t> reference; //previous frame, as decoded
+	std::vector<uint8_t> residuals; //zigzag coded
+	bool hasReference = false;
+
+	void quantize(const uint8_t* frame, bool key);
+	size_t code(FrameCodecType type, uint8_t* out) const;
+};
+
+class FrameDecoder {
+public:
+	FrameDecoder(uint16_t width, uint16_t height);
+
+	/**
+	 * @return the decoded frame, valid until the next call, or nullptr if the data is corrupt or is a delta
+	 * frame without a previous frame
+	 */
+	const uint8_t* decode(const uint8_t* data, size_t size);
+
+private:
+	const uint16_t width, height;
+
+	std::vector<uint8_t> frame;
+	std::vector<uint8_t> residuals;
+	bool hasReference = false;
+};
+
+#endif //THUNDER_DETECTOR_FRAMECODEC_H
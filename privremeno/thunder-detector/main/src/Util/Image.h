@@ -0,0 +1,246 @@
+#ifndef THUNDER_DETECTOR_IMAGE_H
+#define THUNDER_DETECTOR_IMAGE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__)
+#define IMAGE_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define IMAGE_NEON
+#include <arm_neon.h>
+#endif
+
+/**
+ * 8-bit grayscale view over pixels owned elsewhere (camera buffer, RegionBuffer), the part of cv::Mat the
+ * detector used. Rows are 'stride' bytes apart, 'width' when left 0.
+ */
+struct ImageView {
+	ImageView(const uint8_t* data, uint32_t width, uint32_t height, size_t stride = 0) : data((uint8_t*) data), width(width), height(height),
+																						  stride(stride ? stride : width){}
+
+	uint8_t* row(uint32_t y) const{ return data + y * stride; }
+	size_t pixels() const{ return (size_t) width * height; }
+	bool sameSize(const ImageView& other) const{ return width == other.width && height == other.height; }
+
+	uint8_t* data;
+	uint32_t width, height;
+	size_t stride;
+};
+
+/**
+ * The few image kernels the detector and the benchmark need, in place of OpenCV core and imgproc. Results match
+ * cv::resize (INTER_LINEAR, INTER_AREA), cv::absdiff, cv::threshold (THRESH_BINARY), cv::countNonZero and cv::sum within 1 per
+ * pixel. The flat kernels have SSE2 and NEON (AArch64) paths for the host, the device runs the scalar loops.
+ */
+class Image {
+public:
+	static void copy(const ImageView& src, const ImageView& dst){
+		if(src.stride == src.width && dst.stride == dst.width){
+			memcpy(dst.data, src.data, src.pixels());
+			return;
+		}
+		for(uint32_t y = 0; y < src.height; y++){
+			memcpy(dst.row(y), src.row(y), src.width);
+		}
+	}
+
+	/**
+	 * Resizes 'src' to the size of 'dst' by bilinear interpolation, pixel centres aligned as in cv::resize. At 2x down
+	 * that averages 2x2 blocks, as OpenCV's switch to INTER_AREA does.
+	 */
+	static void resize(const ImageView& src, const ImageView& dst){
+		if(src.sameSize(dst)){
+			copy(src, dst);
+			return;
+		}
+		resizeBilinear(src, dst);
+	}
+
+	static void resizeBilinear(const ImageView& src, const ImageView& dst){
+		const Mapping mapY(src.height, dst.height);
+		const Mapping mapX(src.width, dst.width);
+
+		int32_t posY = mapY.start;
+		for(uint32_t y = 0; y < dst.height; y++, posY += mapY.step){
+			uint32_t sy, wy;
+			mapY.source(posY, sy, wy);
+			const uint8_t* top = src.row(sy);
+			const uint8_t* bottom = src.row(sy + (wy ? 1 : 0));
+			uint8_t* out = dst.row(y);
+
+			int32_t posX = mapX.start;
+			for(uint32_t x = 0; x < dst.width; x++, posX += mapX.step){
+				uint32_t sx, wx;
+				mapX.source(posX, sx, wx);
+				const uint32_t right = sx + (wx ? 1 : 0);
+
+				//both passes in 11-bit fixed-point, as OpenCV's 8-bit path: 255 * 2^22 still fits
+				const uint32_t upper = top[sx] * (CoefOne - wx) + top[right] * wx;
+				const uint32_t lower = bottom[sx] * (CoefOne - wx) + bottom[right] * wx;
+				out[x] = (upper * (CoefOne - wy) + lower * wy + (1u << (2 * CoefBits - 1))) >> (2 * CoefBits);
+			}
+		}
+	}
+
+	/**
+	 * Averages blocks of src.width / dst.width by src.height / dst.height pixels, cv::resize with INTER_AREA. The sizes
+	 * have to divide. Unlike bilinear, every source pixel counts, so a small flash isn't skipped at 3x and more.
+	 */
+	static void downscaleBox(const ImageView& src, const ImageView& dst){
+		const uint32_t fx = src.width / dst.width, fy = src.height / dst.height;
+		const uint32_t area = fx * fy;
+
+		if(fx == 2 && fy == 2){
+			for(uint32_t y = 0; y < dst.height; y++){
+				const uint8_t* top = src.row(2 * y);
+				const uint8_t* bottom = src.row(2 * y + 1);
+				uint8_t* out = dst.row(y);
+				for(uint32_t x = 0; x < dst.width; x++){
+					out[x] = (top[2 * x] + top[2 * x + 1] + bottom[2 * x] + bottom[2 * x + 1] + 2) >> 2;
+				}
+			}
+			return;
+		}
+
+		for(uint32_t y = 0; y < dst.height; y++){
+			uint8_t* out = dst.row(y);
+			for(uint32_t x = 0; x < dst.width; x++){
+				uint32_t total = 0;
+				for(uint32_t by = 0; by < fy; by++){
+					const uint8_t* in = src.row(y * fy + by) + x * fx;
+					for(uint32_t bx = 0; bx < fx; bx++){
+						total += in[bx];
+					}
+				}
+				out[x] = (total + area / 2) / area;
+			}
+		}
+	}
+
+	//dst = |a - b|
+	static void absdiff(const uint8_t* a, const uint8_t* b, uint8_t* dst, size_t pixels){
+		size_t i = 0;
+#ifdef IMAGE_SSE2
+		for(; i + 16 <= pixels; i += 16){
+			const __m128i va = _mm_loadu_si128((const __m128i*) (a + i)), vb = _mm_loadu_si128((const __m128i*) (b + i));
+			_mm_storeu_si128((__m128i*) (dst + i), _mm_or_si128(_mm_subs_epu8(va, vb), _mm_subs_epu8(vb, va)));
+		}
+#elif defined(IMAGE_NEON)
+		for(; i + 16 <= pixels; i += 16){
+			vst1q_u8(dst + i, vabdq_u8(vld1q_u8(a + i), vld1q_u8(b + i)));
+		}
+#endif
+		for(; i < pixels; i++){
+			dst[i] = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+		}
+	}
+
+	//dst = src > level ? maxValue : 0
+	static void threshold(const uint8_t* src, uint8_t* dst, size_t pixels, uint8_t level, uint8_t maxValue){
+		size_t i = 0;
+#ifdef IMAGE_SSE2
+		//unsigned compare: src > level where max(src, level + 1) == src, nothing is above 255
+		if(level < 255){
+			const __m128i above = _mm_set1_epi8((char) (level + 1)), value = _mm_set1_epi8((char) maxValue);
+			for(; i + 16 <= pixels; i += 16){
+				const __m128i v = _mm_loadu_si128((const __m128i*) (src + i));
+				const __m128i mask = _mm_cmpeq_epi8(_mm_max_epu8(v, above), v);
+				_mm_storeu_si128((__m128i*) (dst + i), _mm_and_si128(mask, value));
+			}
+		}
+#elif defined(IMAGE_NEON)
+		const uint8x16_t vlevel = vdupq_n_u8(level), value = vdupq_n_u8(maxValue);
+		for(; i + 16 <= pixels; i += 16){
+			vst1q_u8(dst + i, vandq_u8(vcgtq_u8(vld1q_u8(src + i), vlevel), value));
+		}
+#endif
+		for(; i < pixels; i++){
+			dst[i] = src[i] > level ? maxValue : 0;
+		}
+	}
+
+	static size_t countNonZero(const uint8_t* src, size_t pixels){
+		size_t count = 0, i = 0;
+#ifdef IMAGE_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for(; i + 16 <= pixels; i += 16){
+			const __m128i v = _mm_loadu_si128((const __m128i*) (src + i));
+			count += 16 - __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+		}
+#elif defined(IMAGE_NEON)
+		//nonzero bytes as 1, summed in 16-bit lanes before they could overflow
+		while(i + 16 <= pixels){
+			uint16x8_t lanes = vdupq_n_u16(0);
+			for(size_t block = 0; block < 255 && i + 16 <= pixels; block++, i += 16){
+				lanes = vpadalq_u8(lanes, vminq_u8(vld1q_u8(src + i), vdupq_n_u8(1)));
+			}
+			count += vaddvq_u16(lanes);
+		}
+#endif
+		for(; i < pixels; i++){
+			count += src[i] != 0;
+		}
+		return count;
+	}
+
+	static uint64_t sum(const uint8_t* src, size_t pixels){
+		uint64_t total = 0;
+		size_t i = 0;
+#ifdef IMAGE_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		__m128i acc = zero;
+		for(; i + 16 <= pixels; i += 16){
+			acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128((const __m128i*) (src + i)), zero));
+		}
+		uint64_t lanes[2];
+		_mm_storeu_si128((__m128i*) lanes, acc);
+		total = lanes[0] + lanes[1];
+#elif defined(IMAGE_NEON)
+		uint64x2_t acc = vdupq_n_u64(0);
+		for(; i + 16 <= pixels; i += 16){
+			acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(vld1q_u8(src + i))));
+		}
+		total = vaddvq_u64(acc);
+#endif
+		for(; i < pixels; i++){
+			total += src[i];
+		}
+		return total;
+	}
+
+private:
+	static constexpr uint32_t CoefBits = 11; //INTER_RESIZE_COEF_BITS
+	static constexpr uint32_t CoefOne = 1 << CoefBits;
+
+	/**
+	 * Source coordinate of every destination pixel in 16.16 fixed-point, stepped instead of divided: pixel d maps to
+	 * (d + 0.5) * src / dst - 0.5. Positions past either edge clamp to it.
+	 */
+	struct Mapping {
+		Mapping(uint32_t src, uint32_t dst) : last(src - 1), step((int32_t) (((uint64_t) src << 16) / dst)), start(step / 2 - (1 << 15)){}
+
+		//Source pixel and the 11-bit weight of the one after it
+		void source(int32_t pos, uint32_t& pixel, uint32_t& weight) const{
+			if(pos <= 0){
+				pixel = 0;
+				weight = 0;
+				return;
+			}
+			pixel = pos >> 16;
+			weight = (pos & 0xFFFF) >> (16 - CoefBits);
+			if(pixel >= last){
+				pixel = last;
+				weight = 0;
+			}
+		}
+
+		const uint32_t last;
+		const int32_t step, start;
+	};
+};
+
+
+#endif //THUNDER_DETECTOR_IMAGE_H
@@ -0,0 +1,256 @@
+#include "Instrumentation.h"
+
+#ifdef CONFIG_INSTRUMENTATION
+
+#include "Threaded.h"
+#include "Timer.h"
+#include <esp_log.h>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <cinttypes>
+
+static const char* TAG = "Stats";
+
+Instrumentation::TaskStats Instrumentation::tasks[MaxTasks] = {};
+Instrumentation::QueueStats Instrumentation::queues[MaxQueues] = {};
+portMUX_TYPE Instrumentation::lock = portMUX_INITIALIZER_UNLOCKED;
+uint64_t Instrumentation::lastSampleTime = 0;
+uint32_t Instrumentation::samples = 0;
+
+void Instrumentation::start(){
+	static ThreadedClosure thread(&Instrumentation::loop, "Stats", 3 * 1024, 2);
+	lastSampleTime = micros();
+	thread.start();
+}
+
+void Instrumentation::add(Threaded* thread){
+	taskENTER_CRITICAL(&lock);
+	for(auto& t : tasks){
+		if(t.thread != nullptr) continue;
+		memset(&t, 0, sizeof(t));
+		t.thread = thread;
+		t.minFreeStack = UINT32_MAX;
+		taskEXIT_CRITICAL(&lock);
+		return;
+	}
+	taskEXIT_CRITICAL(&lock);
+	ESP_LOGW(TAG, "Too many tasks, %s not instrumented", thread->getName());
+}
+
+void Instrumentation::remove(Threaded* thread){
+	for(auto& t : tasks){
+		taskENTER_CRITICAL(&lock);
+		const bool found = t.thread == thread;
+		taskEXIT_CRITICAL(&lock);
+		if(!found) continue;
+
+		waitUnpinned(t.pins);
+		t.thread = nullptr;
+		taskEXIT_CRITICAL(&lock);
+	}
+}
+
+void Instrumentation::add(QueueHandle_t queue, const char* name, size_t capacity){
+	taskENTER_CRITICAL(&lock);
+	for(auto& q : queues){
+		if(q.handle != nullptr) continue;
+		memset(&q, 0, sizeof(q));
+		q.handle = queue;
+		q.name = name;
+		q.capacity = capacity;
+		taskEXIT_CRITICAL(&lock);
+		return;
+	}
+	taskEXIT_CRITICAL(&lock);
+	ESP_LOGW(TAG, "Too many queues, %s not instrumented", name);
+}
+
+void Instrumentation::remove(QueueHandle_t queue){
+	for(auto& q : queues){
+		taskENTER_CRITICAL(&lock);
+		const bool found = q.handle == queue;
+		taskEXIT_CRITICAL(&lock);
+		if(!found) continue;
+
+		waitUnpinned(q.pins);
+		q.handle = nullptr;
+		taskEXIT_CRITICAL(&lock);
+	}
+}
+
+Threaded* Instrumentation::pin(TaskStats& stats){
+	taskENTER_CRITICAL(&lock);
+	Threaded* thread = stats.thread;
+	if(thread){
+		stats.pins++;
+	}
+	taskEXIT_CRITICAL(&lock);
+	return thread;
+}
+
+QueueHandle_t Instrumentation::pin(QueueStats& stats){
+	taskENTER_CRITICAL(&lock);
+	QueueHandle_t handle = stats.handle;
+	if(handle){
+		stats.pins++;
+	}
+	taskEXIT_CRITICAL(&lock);
+	return handle;
+}
+
+void Instrumentation::unpin(uint8_t& pins){
+	taskENTER_CRITICAL(&lock);
+	pins--;
+	taskEXIT_CRITICAL(&lock);
+}
+
+//Returns inside the critical section, with no reads left, for the caller to clear the entry
+void Instrumentation::waitUnpinned(uint8_t& pins){
+	for(;;){
+		taskENTER_CRITICAL(&lock);
+		if(pins == 0) return;
+		taskEXIT_CRITICAL(&lock);
+		vTaskDelay(1);
+	}
+}
+
+void Instrumentation::loop(){
+	static constexpr uint32_t ReportSamples = CONFIG_INSTRUMENTATION_REPORT_S * 1000 / CONFIG_INSTRUMENTATION_SAMPLE_MS;
+
+	static TickType_t wake = xTaskGetTickCount();
+	vTaskDelayUntil(&wake, pdMS_TO_TICKS(CONFIG_INSTRUMENTATION_SAMPLE_MS));
+
+	sample();
+
+	if(++samples >= ReportSamples){
+		report();
+		samples = 0;
+	}
+}
+
+void Instrumentation::sample(){
+	const uint64_t now = micros();
+	const auto elapsed = (uint32_t) (now - lastSampleTime);
+	lastSampleTime = now;
+
+	for(auto& t : tasks){
+		Threaded* thread = pin(t);
+		if(thread == nullptr) continue;
+		sampleTask(t, thread, elapsed);
+		unpin(t.pins);
+	}
+
+	for(auto& q : queues){
+		QueueHandle_t handle = pin(q);
+		if(handle == nullptr) continue;
+
+		const size_t depth = uxQueueMessagesWaiting(handle);
+		q.maxDepth = std::max(q.maxDepth, depth);
+		q.depthHist[depth * DepthBins / q.capacity]++;
+		unpin(q.pins);
+	}
+}
+
+void Instrumentation::sampleTask(TaskStats& t, Threaded* thread, uint32_t elapsed){
+	if(!thread->running()) return;
+
+	//the task can end and be deleted at any time, its TCB is only read while it can't
+	TaskStatus_t status;
+	TaskHandle_t handle = nullptr;
+	thread->withTask([&status, &handle](TaskHandle_t task){
+		vTaskGetInfo(task, &status, pdTRUE, eRunning);
+		handle = task;
+	});
+	if(handle == nullptr) return;
+
+	if(handle != t.lastTask){
+		//first sample after (re)start only establishes the run time baseline
+		t.lastTask = handle;
+		t.lastRunTime = status.ulRunTimeCounter;
+		return;
+	}
+
+	//run time counter is esp_timer based [us], unsigned difference handles the wrap-around
+	const uint32_t run = status.ulRunTimeCounter - t.lastRunTime;
+	t.lastRunTime = status.ulRunTimeCounter;
+
+	const size_t bin = elapsed ? std::min<size_t>((uint64_t) run * CpuBins / elapsed, CpuBins - 1) : 0;
+	t.cpuHist[bin]++;
+
+	t.minFreeStack = std::min<uint32_t>(t.minFreeStack, status.usStackHighWaterMark);
+}
+
+//Upper edge of the histogram bin below which 'fraction' of samples lie
+static size_t percentile(const uint32_t* hist, size_t bins, float fraction){
+	uint32_t total = 0;
+	for(size_t i = 0; i < bins; i++){
+		total += hist[i];
+	}
+
+	const uint32_t target = total * fraction;
+	uint32_t acc = 0;
+	for(size_t i = 0; i < bins; i++){
+		acc += hist[i];
+		if(acc > target) return i + 1;
+	}
+	return bins;
+}
+
+void Instrumentation::report(){
+	static char buf[1024];
+	size_t len = 0;
+
+	len += snprintf(buf + len, sizeof(buf) - len, "[stats] t=%llus\n%-12s %4s %4s %4s %8s\n", millis() / 1000, "task", "p50%", "p90%", "max%", "minFree");
+
+	for(auto& t : tasks){
+		if(len >= sizeof(buf)) break;
+		Threaded* thread = pin(t);
+		if(thread == nullptr) continue;
+
+		size_t max = 0;
+		for(size_t i = 0; i < CpuBins; i++){
+			if(t.cpuHist[i]) max = i + 1;
+		}
+
+		const auto step = 100 / CpuBins;
+		len += snprintf(buf + len, sizeof(buf) - len, "%-12s %4zu %4zu %4zu %8" PRIu32 "\n", thread->getName(),
+						percentile(t.cpuHist, CpuBins, 0.5f) * step, percentile(t.cpuHist, CpuBins, 0.9f) * step, max * step,
+						t.minFreeStack == UINT32_MAX ? 0 : t.minFreeStack);
+
+		memset(t.cpuHist, 0, sizeof(t.cpuHist));
+		unpin(t.pins);
+	}
+
+	for(auto& q : queues){
+		if(len >= sizeof(buf)) break;
+		if(pin(q) == nullptr) continue;
+
+		len += snprintf(buf + len, sizeof(buf) - len, "%-12s max %zu/%zu hist", q.name, q.maxDepth, q.capacity);
+		for(size_t i = 0; i <= DepthBins && len < sizeof(buf); i++){
+			len += snprintf(buf + len, sizeof(buf) - len, " %" PRIu32, q.depthHist[i]);
+		}
+		if(len < sizeof(buf)){
+			len += snprintf(buf + len, sizeof(buf) - len, "\n");
+		}
+
+		memset(q.depthHist, 0, sizeof(q.depthHist));
+		q.maxDepth = 0;
+		unpin(q.pins);
+	}
+
+	len = std::min(len, sizeof(buf) - 1);
+	printf("%s", buf);
+
+#ifdef CONFIG_INSTRUMENTATION_SD
+	FILE* file = fopen("/sd/stats.txt", "a");
+	if(!file){
+		ESP_LOGE(TAG, "error opening stats file on SD!");
+		return;
+	}
+	fwrite(buf, 1, len, file);
+	fclose(file);
+#endif
+}
+
+#endif
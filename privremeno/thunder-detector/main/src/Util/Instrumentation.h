@@ -0,0 +1,85 @@
+#ifndef THUNDER_DETECTOR_INSTRUMENTATION_H
+#define THUNDER_DETECTOR_INSTRUMENTATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <sdkconfig.h>
+
+class Threaded;
+
+#ifdef CONFIG_INSTRUMENTATION
+
+/**
+ * Samples CPU usage and stack high-water mark of registered Threaded tasks and occupancy of registered
+ * queues every CONFIG_INSTRUMENTATION_SAMPLE_MS into fixed histograms, and reports them every
+ * CONFIG_INSTRUMENTATION_REPORT_S. Threaded and Queue register themselves on construction.
+ */
+class Instrumentation {
+public:
+	static void start();
+
+	static void add(Threaded* thread);
+	static void remove(Threaded* thread);
+
+	static void add(QueueHandle_t queue, const char* name, size_t capacity);
+	static void remove(QueueHandle_t queue);
+
+	static constexpr size_t MaxTasks = 8;
+	static constexpr size_t MaxQueues = 8;
+	static constexpr size_t CpuBins = 20; //5% per bin
+	static constexpr size_t DepthBins = 8; //1/8 of capacity per bin
+
+private:
+	struct TaskStats {
+		Threaded* thread;
+		uint8_t pins; //reads of 'thread' in progress, remove() waits for them
+		TaskHandle_t lastTask;
+		uint32_t lastRunTime;
+		uint32_t minFreeStack;
+		uint32_t cpuHist[CpuBins];
+	};
+
+	struct QueueStats {
+		QueueHandle_t handle;
+		uint8_t pins;
+		const char* name;
+		size_t capacity;
+		size_t maxDepth;
+		uint32_t depthHist[DepthBins + 1]; //last bin is "full"
+	};
+
+	static TaskStats tasks[MaxTasks];
+	static QueueStats queues[MaxQueues];
+	static portMUX_TYPE lock;
+
+	static uint64_t lastSampleTime;
+	static uint32_t samples;
+
+	//Entries are read outside 'lock' while pinned: the thread or queue is returned and can't be removed until unpinned
+	static Threaded* pin(TaskStats& stats);
+	static QueueHandle_t pin(QueueStats& stats);
+	static void unpin(uint8_t& pins);
+	static void waitUnpinned(uint8_t& pins);
+
+	static void sample();
+	static void sampleTask(TaskStats& stats, Threaded* thread, uint32_t elapsed);
+	static void report();
+	static void loop();
+};
+
+#else
+
+class Instrumentation {
+public:
+	static void start(){}
+	static void add(Threaded*){}
+	static void remove(Threaded*){}
+	static void add(QueueHandle_t, const char*, size_t){}
+	static void remove(QueueHandle_t){}
+};
+
+#endif
+
+#endif //THUNDER_DETECTOR_INSTRUMENTATION_H
@@ -0,0 +1,323 @@
+#include "JpegDc.h"
+#include <algorithm>
+#include <cstring>
+
+enum Marker : uint8_t {
+	Sof0 = 0xC0, Sof1 = 0xC1, Dht = 0xC4, Rst0 = 0xD0, Rst7 = 0xD7, Soi = 0xD8, Eoi = 0xD9, Sos = 0xDA, Dqt = 0xDB, Dri = 0xDD
+};
+
+//Every SOFn other than the baseline and extended sequential Huffman ones
+static inline bool unsupportedFrame(uint8_t marker){
+	return marker >= 0xC2 && marker <= 0xCF && marker != Dht && marker != 0xC8 && marker != 0xCC;
+}
+
+static inline uint16_t be16(const uint8_t* data){
+	return (data[0] << 8) | data[1];
+}
+
+void JpegDcDecoder::BitReader::start(const uint8_t* data, size_t size){
+	this->data = data;
+	this->size = size;
+	pos = 0;
+	acc = 0;
+	count = 0;
+	atMarker = false;
+	padding = 0;
+}
+
+void JpegDcDecoder::BitReader::fill(){
+	while(count <= 24){
+		uint32_t byte = 0;
+		if(!atMarker && pos < size && (data[pos] != 0xFF || (pos + 1 < size && data[pos + 1] == 0))){
+			byte = data[pos];
+			pos += byte == 0xFF ? 2 : 1;
+		}else{
+			atMarker = true;
+			padding++;
+		}
+
+		acc |= byte << (24 - count);
+		count += 8;
+	}
+}
+
+int32_t JpegDcDecoder::BitReader::receiveExtend(uint8_t bits){
+	if(bits == 0) return 0;
+	fill();
+	const int32_t value = acc >> (32 - bits);
+	skip(bits);
+	//values with the top bit clear are negative
+	return value < (1 << (bits - 1)) ? value - (1 << bits) + 1 : value;
+}
+
+bool JpegDcDecoder::BitReader::restart(){
+	//the rest of the byte is padding, the marker follows
+	acc = 0;
+	count = 0;
+	padding = 0;
+
+	while(!atMarker && pos < size){
+		if(data[pos] == 0xFF && pos + 1 < size && data[pos + 1] != 0){
+			atMarker = true;
+		}else{
+			pos++;
+		}
+	}
+
+	if(pos + 1 >= size || data[pos + 1] < Rst0 || data[pos + 1] > Rst7) return false;
+	pos += 2;
+	atMarker = false;
+	return true;
+}
+
+bool JpegDcDecoder::decode(const uint8_t* data, size_t size){
+	if(size < 4 || data[0] != 0xFF || data[1] != Soi) return false;
+
+	componentCount = 0;
+	restartInterval = 0;
+
+	size_t pos = 2;
+	while(pos + 4 <= size){
+		if(data[pos] != 0xFF) return false;
+		const uint8_t marker = data[pos + 1];
+		if(marker == 0xFF){
+			pos++; //fill byte
+			continue;
+		}
+		if(marker == Eoi) return false; //no scan
+
+		const size_t len = be16(data + pos + 2);
+		if(len < 2 || pos + 2 + len > size) return false;
+		const uint8_t* seg = data + pos + 4;
+		const size_t segLen = len - 2;
+		pos += 2 + len;
+
+		bool ok = true;
+		switch(marker){
+			case Dqt:
+				ok = parseQuant(seg, segLen);
+				break;
+			case Dht:
+				ok = parseHuffman(seg, segLen);
+				break;
+			case Sof0:
+			case Sof1:
+				ok = parseFrame(seg, segLen);
+				break;
+			case Dri:
+				ok = segLen >= 2;
+				if(ok){
+					restartInterval = be16(seg);
+				}
+				break;
+			case Sos:
+				//the luminance is in the first scan, nothing after it is needed
+				return decodeScan(seg, segLen, data + pos, size - pos);
+			default:
+				ok = !unsupportedFrame(marker);
+				break;
+		}
+		if(!ok) return false;
+	}
+
+	return false;
+}
+
+bool JpegDcDecoder::parseQuant(const uint8_t* seg, size_t len){
+	while(len > 0){
+		const uint8_t precision = seg[0] >> 4, id = seg[0] & 0x0F;
+		const size_t tableLen = 1 + 64 * (precision + 1);
+		if(precision > 1 || id > 3 || len < tableLen) return false;
+
+		//the first entry in zigzag order is the DC one
+		quantDC[id] = precision ? be16(seg + 1) : seg[1];
+
+		seg += tableLen;
+		len -= tableLen;
+	}
+	return true;
+}
+
+bool JpegDcDecoder::parseHuffman(const uint8_t* seg, size_t len){
+	while(len > 0){
+		if(len < 17) return false;
+		const uint8_t tableClass = seg[0] >> 4, id = seg[0] & 0x0F;
+		if(tableClass > 1 || id > 3) return false;
+
+		const uint8_t* counts = seg + 1;
+		size_t total = 0;
+		for(int i = 0; i < 16; i++){
+			total += counts[i];
+		}
+		if(total > 256 || len < 17 + total) return false;
+
+		HuffmanTable& table = tableClass == 0 ? dcTables[id] : acTables[id];
+		memcpy(table.symbols, seg + 17, total);
+		memset(table.fast, 0, sizeof(table.fast));
+
+		//canonical codes (JPEG Annex C): consecutive within a length, doubled for the next length
+		int32_t code = 0;
+		size_t index = 0;
+		for(uint8_t length = 1; length <= 16; length++){
+			table.offset[length] = (int32_t) index - code;
+			for(uint8_t i = 0; i < counts[length - 1]; i++, code++, index++){
+				if(length <= FastBits){
+					const uint32_t first = code << (FastBits - length), fill = 1u << (FastBits - length);
+					for(uint32_t j = 0; j < fill; j++){
+						table.fast[first + j] = (length << 8) | table.symbols[index];
+					}
+				}
+			}
+			table.maxCode[length] = code;
+			if(code > (1 << length)) return false;
+			code <<= 1;
+		}
+
+		table.defined = true;
+		seg += 17 + total;
+		len -= 17 + total;
+	}
+	return true;
+}
+
+bool JpegDcDecoder::parseFrame(const uint8_t* seg, size_t len){
+	if(len < 6 || seg[0] != 8) return false;
+
+	imageHeight = be16(seg + 1);
+	imageWidth = be16(seg + 3);
+	componentCount = seg[5];
+	if(imageWidth == 0 || imageHeight == 0 || componentCount == 0 || componentCount > 4 || len < 6 + 3 * (size_t) componentCount) return false;
+
+	hMax = vMax = 1;
+	for(uint8_t i = 0; i < componentCount; i++){
+		Component& comp = components[i];
+		comp.id = seg[6 + 3 * i];
+		comp.h = seg[7 + 3 * i] >> 4;
+		comp.v = seg[7 + 3 * i] & 0x0F;
+		comp.quant = seg[8 + 3 * i];
+		if(comp.h < 1 || comp.h > 4 || comp.v < 1 || comp.v > 4 || comp.quant > 3) return false;
+
+		hMax = std::max(hMax, comp.h);
+		vMax = std::max(vMax, comp.v);
+	}
+
+	//a luminance block has to be 8x8 image pixels
+	if(components[0].h != hMax || components[0].v != vMax) return false;
+
+	width = (imageWidth + 7) / 8;
+	height = (imageHeight + 7) / 8;
+	pixels.resize(width * height);
+	return true;
+}
+
+int JpegDcDecoder::decodeSymbol(const HuffmanTable& table){
+	const uint32_t bits = reader.peek16();
+
+	const uint16_t fast = table.fast[bits >> (16 - FastBits)];
+	if(fast){
+		reader.skip(fast >> 8);
+		return fast & 0xFF;
+	}
+
+	for(uint8_t length = FastBits + 1; length <= 16; length++){
+		const int32_t code = bits >> (16 - length);
+		if(code < table.maxCode[length]){
+			reader.skip(length);
+			return table.symbols[table.offset[length] + code];
+		}
+	}
+	return -1;
+}
+
+bool JpegDcDecoder::decodeBlock(Component& comp){
+	const int dc = decodeSymbol(dcTables[comp.dcTable]);
+	if(dc < 0 || dc > 11) return false;
+	comp.prediction += reader.receiveExtend(dc);
+
+	//AC coefficients are only skipped, (run << 4) | size each
+	for(int k = 1; k < 64; k++){
+		const int symbol = decodeSymbol(acTables[comp.acTable]);
+		if(symbol < 0) return false;
+
+		const uint8_t run = symbol >> 4, bits = symbol & 0x0F;
+		if(bits == 0){
+			if(run != 15) break; //end of block
+			k += 15;
+			continue;
+		}
+
+		k += run;
+		reader.discard(bits);
+	}
+	return true;
+}
+
+bool JpegDcDecoder::decodeScan(const uint8_t* seg, size_t len, const uint8_t* data, size_t size){
+	if(componentCount == 0 || len < 1) return false;
+
+	const uint8_t scanCount = seg[0];
+	if(scanCount == 0 || scanCount > componentCount || len < 1 + 2 * (size_t) scanCount + 3) return false;
+
+	Component* scan[4];
+	bool hasLuma = false;
+	for(uint8_t i = 0; i < scanCount; i++){
+		const uint8_t id = seg[1 + 2 * i], tables = seg[2 + 2 * i];
+		scan[i] = std::find_if(components, components + componentCount, [id](const Component& c){ return c.id == id; });
+		if(scan[i] == components + componentCount) return false;
+
+		scan[i]->dcTable = tables >> 4;
+		scan[i]->acTable = tables & 0x0F;
+		scan[i]->prediction = 0;
+		if(scan[i]->dcTable > 3 || scan[i]->acTable > 3 || !dcTables[scan[i]->dcTable].defined || !acTables[scan[i]->acTable].defined) return false;
+
+		hasLuma = hasLuma || scan[i] == components;
+	}
+	if(!hasLuma) return false;
+
+	//a single component scan has one block per MCU, an interleaved one h x v of each component
+	const bool interleaved = scanCount > 1;
+	const uint32_t mcusX = interleaved ? (imageWidth + 8 * hMax - 1) / (8 * hMax) : width;
+	const uint32_t mcusY = interleaved ? (imageHeight + 8 * vMax - 1) / (8 * vMax) : height;
+	const int32_t scale = quantDC[components[0].quant];
+
+	reader.start(data, size);
+	uint32_t untilRestart = restartInterval;
+
+	for(uint32_t mcuY = 0; mcuY < mcusY; mcuY++){
+		for(uint32_t mcuX = 0; mcuX < mcusX; mcuX++){
+			if(restartInterval){
+				if(untilRestart == 0){
+					if(!reader.restart()) return false;
+					for(uint8_t i = 0; i < scanCount; i++){
+						scan[i]->prediction = 0;
+					}
+					untilRestart = restartInterval;
+				}
+				untilRestart--;
+			}
+
+			for(uint8_t i = 0; i < scanCount; i++){
+				Component& comp = *scan[i];
+				const uint8_t blocksX = interleaved ? comp.h : 1, blocksY = interleaved ? comp.v : 1;
+
+				for(uint8_t by = 0; by < blocksY; by++){
+					for(uint8_t bx = 0; bx < blocksX; bx++){
+						if(!decodeBlock(comp)) return false;
+						if(&comp != components) continue;
+
+						//blocks past the edge of the image only pad the MCU
+						const uint32_t x = mcuX * blocksX + bx, y = mcuY * blocksY + by;
+						if(x >= width || y >= height) continue;
+
+						//block mean is DC / 8, plus the level shift
+						pixels[y * width + x] = std::clamp<int32_t>((comp.prediction * scale + 1024 + 4) >> 3, 0, 255);
+					}
+				}
+			}
+
+			if(reader.padding > 8) return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,113 @@
+#ifndef THUNDER_DETECTOR_JPEGDC_H
+#define THUNDER_DETECTOR_JPEGDC_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Luminance at 1/8 of the resolution of a baseline JPEG (camera PIXFORMAT_JPEG), without an IDCT.
+ * The DC coefficient of every 8x8 luminance block is the mean of its pixels, so only the Huffman
+ * codes are decoded - AC coefficients are skipped, chroma blocks are skipped entirely.
+ * One pixel per block: a 640x480 frame gives 80x60, 1280x1024 gives 160x128.
+ *
+ * Handles grayscale and YCbCr of any sampling where luminance is not subsampled (the OV2640 sends
+ * 4:2:2), restart intervals, and multi-scan files as long as the first scan has the luminance.
+ * Progressive, arithmetic coded and 12-bit files are rejected.
+ */
+class JpegDcDecoder {
+public:
+	/**
+	 * @return false if the data isn't a supported JPEG or is damaged before the last block
+	 */
+	bool decode(const uint8_t* data, size_t size);
+
+	uint16_t getWidth() const{ return width; }
+	uint16_t getHeight() const{ return height; }
+
+	//getWidth() x getHeight(), valid after a successful decode()
+	const uint8_t* getPixels() const{ return pixels.data(); }
+
+private:
+	static constexpr uint8_t FastBits = 9; //Huffman codes up to this long are decoded with one lookup
+
+	struct HuffmanTable {
+		uint16_t fast[1 << FastBits]; //(length << 8) | symbol, 0 if the code is longer
+		int32_t maxCode[17]; //one past the last code of each length
+		int32_t offset[17]; //index into 'symbols' of a code of each length, minus the code
+		uint8_t symbols[256];
+		bool defined = false;
+	};
+
+	struct Component {
+		uint8_t id;
+		uint8_t h, v; //sampling factors
+		uint8_t quant; //table index
+		uint8_t dcTable, acTable;
+		int32_t prediction;
+	};
+
+	//Entropy coded data with 0xFF00 unstuffed, stops at the next marker
+	class BitReader {
+	public:
+		void start(const uint8_t* data, size_t size);
+
+		uint32_t peek16(){
+			fill();
+			return acc >> 16;
+		}
+
+		void skip(uint8_t bits){
+			acc <<= bits;
+			count -= bits;
+		}
+
+		void discard(uint8_t bits){
+			if(count < bits) fill();
+			skip(bits);
+		}
+
+		int32_t receiveExtend(uint8_t bits);
+
+		//Moves past a restart marker, false if the next marker isn't one
+		bool restart();
+
+		//Zero bytes fed past a marker or the end, more than the lookahead means the data ran out
+		uint32_t padding = 0;
+
+	private:
+		const uint8_t* data = nullptr;
+		size_t size = 0;
+		size_t pos = 0;
+		uint32_t acc = 0;
+		int32_t count = 0;
+		bool atMarker = false;
+
+		void fill();
+	};
+
+	HuffmanTable dcTables[4], acTables[4];
+	uint16_t quantDC[4] = {}; //only the DC entry of each quantization table is needed
+	Component components[4] = {};
+	uint8_t componentCount = 0;
+	uint16_t imageWidth = 0, imageHeight = 0;
+	uint8_t hMax = 1, vMax = 1;
+	uint16_t restartInterval = 0;
+
+	uint16_t width = 0, height = 0;
+	std::vector<uint8_t> pixels;
+
+	BitReader reader;
+
+	bool parseQuant(const uint8_t* seg, size_t len);
+	bool parseHuffman(const uint8_t* seg, size_t len);
+	bool parseFrame(const uint8_t* seg, size_t len);
+	bool decodeScan(const uint8_t* seg, size_t len, const uint8_t* data, size_t size);
+
+	//Decodes one block of 'comp' into its DC prediction, false on a bad code
+	bool decodeBlock(Component& comp);
+	int decodeSymbol(const HuffmanTable& table);
+};
+
+
+#endif //THUNDER_DETECTOR_JPEGDC_H
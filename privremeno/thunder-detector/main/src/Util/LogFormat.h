@@ -0,0 +1,164 @@
+#ifndef THUNDER_DETECTOR_LOGFORMAT_H
+#define THUNDER_DETECTOR_LOGFORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+//Binary deferred log format, shared between the firmware and host/tools/logdecode.
+//A dump is a LogHeader followed by LogRecords. A record of kind String is followed by words[0] bytes of
+//text and defines the format string or tag with the given id, before the first message referencing it.
+
+static constexpr size_t LogMaxWords = 8;
+
+struct LogRecord {
+	enum Kind : uint8_t {
+		Message, String
+	};
+
+	uint64_t timestamp; //[us], micros()
+	uint64_t fmt; //format string id (address on the producing device)
+	uint64_t tag;
+	Kind kind;
+	uint8_t level; //esp_log_level_t
+	uint8_t core;
+	uint8_t count; //number of used words
+	uint32_t words[LogMaxWords]; //raw arguments, 64-bit values and doubles take two words
+};
+static_assert(sizeof(LogRecord) == 64);
+
+struct LogHeader {
+	char magic[4]; //"THLG"
+	uint16_t version;
+	uint8_t recordSize;
+	uint8_t pointerSize; //sizeof(void*) == sizeof(size_t) == sizeof(long) on the producer
+};
+
+static constexpr LogHeader LogHeaderDefault = { { 'T', 'H', 'L', 'G' }, 1, sizeof(LogRecord), sizeof(void*) };
+
+/**
+ * Renders a printf format string with arguments stored as raw words, consuming words per conversion.
+ * @param pointerSize size of long, size_t and pointers on the producer
+ * @param str resolves a %s argument, given its raw value
+ * @return number of characters written, excluding the terminator
+ */
+template<typename StrResolver>
+size_t formatLog(char* out, size_t size, const char* fmt, const uint32_t* words, size_t count, size_t pointerSize, StrResolver str){
+	size_t len = 0;
+	size_t w = 0;
+
+	auto take = [&](size_t n) -> uint64_t{
+		uint64_t v = 0;
+		if(w + n <= count){
+			memcpy(&v, words + w, n * 4);
+		}
+		w += n;
+		return v;
+	};
+
+	while(*fmt && len + 1 < size){
+		if(*fmt != '%'){
+			out[len++] = *fmt++;
+			continue;
+		}
+
+		//copy one conversion specification, e.g. "%-8.2f"
+		char spec[16];
+		size_t s = 0;
+		spec[s++] = *fmt++;
+		while(*fmt && strchr("-+ #0123456789.", *fmt) && s < sizeof(spec) - 4){
+			spec[s++] = *fmt++;
+		}
+
+		int longs = 0;
+		bool sizeT = false;
+		while(*fmt == 'l' || *fmt == 'h' || *fmt == 'z' || *fmt == 'j' || *fmt == 't'){
+			if(*fmt == 'l') longs++;
+			if(*fmt == 'z' || *fmt == 't') sizeT = true;
+			if(*fmt == 'j') longs = 2;
+			fmt++;
+		}
+
+		const char conv = *fmt ? *fmt++ : '\0';
+		const size_t argWords = longs >= 2 ? 2 : (longs == 1 || sizeT) ? pointerSize / 4 : 1;
+		int n = 0;
+
+		switch(conv){
+			case '%':
+				out[len++] = '%';
+				continue;
+
+			case 'd':
+			case 'i':{
+				const uint64_t raw = take(argWords);
+				const long long v = argWords == 2 ? (long long) raw : (long long) (int32_t) raw;
+				spec[s++] = 'l';
+				spec[s++] = 'l';
+				spec[s++] = conv;
+				spec[s] = '\0';
+				n = snprintf(out + len, size - len, spec, v);
+				break;
+			}
+
+			case 'u':
+			case 'x':
+			case 'X':
+			case 'o':
+			case 'c':{
+				const unsigned long long v = take(argWords);
+				if(conv != 'c'){
+					spec[s++] = 'l';
+					spec[s++] = 'l';
+				}
+				spec[s++] = conv;
+				spec[s] = '\0';
+				n = conv == 'c' ? snprintf(out + len, size - len, spec, (int) v) : snprintf(out + len, size - len, spec, v);
+				break;
+			}
+
+			case 'f':
+			case 'F':
+			case 'e':
+			case 'E':
+			case 'g':
+			case 'G':{
+				double v;
+				const uint64_t raw = take(2);
+				memcpy(&v, &raw, sizeof(v));
+				spec[s++] = conv;
+				spec[s] = '\0';
+				n = snprintf(out + len, size - len, spec, v);
+				break;
+			}
+
+			case 's':{
+				const uint64_t raw = take(pointerSize / 4);
+				spec[s++] = 's';
+				spec[s] = '\0';
+				n = snprintf(out + len, size - len, spec, str(raw));
+				break;
+			}
+
+			case 'p':{
+				const unsigned long long v = take(pointerSize / 4);
+				n = snprintf(out + len, size - len, "0x%llx", v);
+				break;
+			}
+
+			default:
+				n = snprintf(out + len, size - len, "<?%c>", conv);
+				break;
+		}
+
+		if(n > 0){
+			len += std::min<size_t>(n, size - len - 1);
+		}
+	}
+
+	out[len] = '\0';
+	return len;
+}
+
+#endif //THUNDER_DETECTOR_LOGFORMAT_H
@@ -0,0 +1,85 @@
+#include "Memory.h"
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <sdkconfig.h>
+
+static const char* TAG = "Memory";
+
+static constexpr const char* RegionNames[] = { "hot", "dma", "bulk" };
+static constexpr uint32_t RegionCaps[] = { MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL, MALLOC_CAP_SPIRAM };
+static constexpr size_t Budgets[] = { CONFIG_MEMORY_HOT_KB * 1024, CONFIG_MEMORY_DMA_KB * 1024, SIZE_MAX };
+static_assert(sizeof(RegionNames) / sizeof(RegionNames[0]) == (size_t) Memory::Region::Count);
+
+std::atomic<size_t> Memory::usage[(size_t) Region::Count] = {};
+std::atomic<size_t> Memory::peaks[(size_t) Region::Count] = {};
+
+bool Memory::reserve(Region region, size_t size){
+	const size_t index = (size_t) region;
+	const size_t now = usage[index].fetch_add(size) + size;
+	if(now > Budgets[index]){
+		usage[index] -= size;
+		return false;
+	}
+
+	size_t peak = peaks[index];
+	while(now > peak && !peaks[index].compare_exchange_weak(peak, now)){}
+	return true;
+}
+
+void* Memory::alloc(Region region, size_t size, const char* owner, Region& placed){
+	placed = region;
+	if(size == 0) return nullptr;
+
+	if(reserve(region, size)){
+		if(void* ptr = heap_caps_calloc(1, size, RegionCaps[(size_t) region])) return ptr;
+		usage[(size_t) region] -= size;
+	}
+
+	//DMA buffers can't live anywhere else
+	if(region == Region::Dma){
+		ESP_LOGE(TAG, "%s: no room for %zu B in %s, %zu B used", owner, size, RegionNames[(size_t) region], used(region));
+		return nullptr;
+	}
+
+	void* ptr = nullptr;
+	if(region == Region::Hot){
+		ESP_LOGW(TAG, "%s: %zu B over the %s budget or heap, placed in PSRAM", owner, size, RegionNames[(size_t) region]);
+		ptr = heap_caps_calloc(1, size, RegionCaps[(size_t) Region::Bulk]);
+	}
+
+	//no PSRAM on the board, bulk buffers go wherever they fit
+	if(!ptr){
+		ptr = heap_caps_calloc(1, size, MALLOC_CAP_DEFAULT);
+	}
+
+	if(!ptr){
+		ESP_LOGE(TAG, "%s: error allocating %zu B", owner, size);
+		return nullptr;
+	}
+
+	placed = Region::Bulk;
+	reserve(placed, size);
+	return ptr;
+}
+
+void Memory::free(void* ptr, size_t size, Region placed){
+	if(!ptr) return;
+
+	heap_caps_free(ptr);
+	usage[(size_t) placed] -= size;
+}
+
+size_t Memory::used(Region region){
+	return usage[(size_t) region];
+}
+
+size_t Memory::peak(Region region){
+	return peaks[(size_t) region];
+}
+
+void Memory::report(){
+	ESP_LOGI(TAG, "hot %.1f / %d kB (peak %.1f), dma %.1f / %d kB (peak %.1f), bulk %.1f kB (peak %.1f)",
+			 used(Region::Hot) / 1024.0f, CONFIG_MEMORY_HOT_KB, peak(Region::Hot) / 1024.0f,
+			 used(Region::Dma) / 1024.0f, CONFIG_MEMORY_DMA_KB, peak(Region::Dma) / 1024.0f,
+			 used(Region::Bulk) / 1024.0f, peak(Region::Bulk) / 1024.0f);
+}
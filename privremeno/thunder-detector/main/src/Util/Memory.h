@@ -0,0 +1,85 @@
+#ifndef THUNDER_DETECTOR_MEMORY_H
+#define THUNDER_DETECTOR_MEMORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Placement of buffers by how they are used, instead of by the size malloc happens to get (over 16 kB goes to
+ * PSRAM). Every internal region has a budget (CONFIG_MEMORY_HOT_KB, CONFIG_MEMORY_DMA_KB): a Hot buffer over it,
+ * or one the internal heap can't fit, goes to PSRAM with a warning, so the budget decides what stays fast.
+ */
+class Memory {
+public:
+	enum class Region : uint8_t {
+		Hot, //internal RAM: read and written every frame or audio block
+		Dma, //internal RAM DMA can reach: SD sector buffers, PSRAM tile copies. Never falls back.
+		Bulk, //PSRAM: large, touched once per frame or less. Internal RAM on boards without PSRAM.
+		Count
+	};
+
+	/**
+	 * @param owner named in the log on fallbacks and failures
+	 * @param placed receives the region the buffer ended up in, to pass to free()
+	 * @return zeroed buffer, nullptr if there was no room
+	 */
+	static void* alloc(Region region, size_t size, const char* owner, Region& placed);
+	static void free(void* ptr, size_t size, Region placed);
+
+	static size_t used(Region region);
+	static size_t peak(Region region);
+
+	//Logs the use, peak and budget of every region
+	static void report();
+
+private:
+	static std::atomic<size_t> usage[(size_t) Region::Count];
+	static std::atomic<size_t> peaks[(size_t) Region::Count];
+
+	//Counts 'size' against the budget of 'region', false if it doesn't fit
+	static bool reserve(Region region, size_t size);
+};
+
+/**
+ * Fixed array placed by Memory, for buffers that would otherwise be a std::vector from the default heap.
+ * Zeroed, empty if the allocation failed.
+ */
+template<typename T>
+class RegionBuffer {
+	static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>);
+
+public:
+	RegionBuffer(Memory::Region region, size_t count, const char* owner) : count(count){
+		buffer = (T*) Memory::alloc(region, count * sizeof(T), owner, placed);
+		if(!buffer){
+			this->count = 0;
+		}
+	}
+
+	~RegionBuffer(){
+		Memory::free(buffer, count * sizeof(T), placed);
+	}
+
+	RegionBuffer(const RegionBuffer&) = delete;
+	RegionBuffer& operator=(const RegionBuffer&) = delete;
+
+	T* data(){ return buffer; }
+	const T* data() const{ return buffer; }
+	size_t size() const{ return count; }
+
+	T& operator[](size_t i){ return buffer[i]; }
+	const T& operator[](size_t i) const{ return buffer[i]; }
+
+	//Where the buffer ended up, Bulk after a fallback
+	Memory::Region region() const{ return placed; }
+
+private:
+	T* buffer;
+	size_t count;
+	Memory::Region placed;
+};
+
+
+#endif //THUNDER_DETECTOR_MEMORY_H
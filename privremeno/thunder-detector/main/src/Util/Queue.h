@@ -6,15 +6,24 @@
 #include <freertos/portmacro.h>
 #include <freertos/queue.h>
 #include <memory>
+#include "StaticArena.h"
+#include "Instrumentation.h"
 
 template<typename T>
 class Queue {
 public:
-	Queue(size_t count){
+	Queue(size_t count, const char* name = "Queue"){
+#ifdef CONFIG_STATIC_ALLOCATION
+		auto storage = (uint8_t*) StaticArena::alloc(count * sizeof(T), alignof(T));
+		queue = xQueueCreateStatic(count, sizeof(T), storage, &queueBuffer);
+#else
 		queue = xQueueCreate(count, sizeof(T));
+#endif
+		Instrumentation::add(queue, name, count);
 	}
 
 	virtual ~Queue(){
+		Instrumentation::remove(queue);
 		vQueueDelete(queue);
 	}
 
@@ -33,16 +42,27 @@ public:
 private:
 	QueueHandle_t queue;
 
+#ifdef CONFIG_STATIC_ALLOCATION
+	StaticQueue_t queueBuffer;
+#endif
+
 };
 
 template<typename T>
 class PtrQueue {
 public:
-	PtrQueue(size_t size) : size(size){
+	PtrQueue(size_t size, const char* name = "PtrQueue") : size(size){
+#ifdef CONFIG_STATIC_ALLOCATION
+		auto storage = (uint8_t*) StaticArena::alloc(size * sizeof(T*), alignof(T*));
+		queue = xQueueCreateStatic(size, sizeof(T*), storage, &queueBuffer);
+#else
 		queue = xQueueCreate(size, sizeof(T*));
+#endif
+		Instrumentation::add(queue, name, size);
 	}
 
 	virtual ~PtrQueue(){
+		Instrumentation::remove(queue);
 		vQueueDelete(queue);
 	}
 
@@ -69,6 +89,10 @@ public:
 private:
 	QueueHandle_t queue;
 
+#ifdef CONFIG_STATIC_ALLOCATION
+	StaticQueue_t queueBuffer;
+#endif
+
 };
 
 #endif //THUNDER_DETECTOR_QUEUE_H
@@ -0,0 +1,37 @@
+#include "StaticArena.h"
+
+#ifdef CONFIG_STATIC_ALLOCATION
+
+#include <freertos/FreeRTOS.h>
+#include <esp_log.h>
+#include <cstdlib>
+
+static const char* TAG = "StaticArena";
+
+alignas(16) static uint8_t pool[CONFIG_STATIC_ARENA_SIZE];
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+size_t StaticArena::head = 0;
+
+void* StaticArena::alloc(size_t size, size_t align){
+	taskENTER_CRITICAL(&lock);
+	const size_t start = (head + align - 1) & ~(align - 1);
+	const bool fits = start + size <= Size;
+	if(fits){
+		head = start + size;
+	}
+	taskEXIT_CRITICAL(&lock);
+
+	if(!fits){
+		ESP_LOGE(TAG, "Arena exhausted: requested %zu, used %zu of %zu", size, head, Size);
+		abort();
+	}
+
+	return pool + start;
+}
+
+size_t StaticArena::used(){
+	return head;
+}
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef THUNDER_DETECTOR_STATICARENA_H
+#define THUNDER_DETECTOR_STATICARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sdkconfig.h>
+
+#ifdef CONFIG_STATIC_ALLOCATION
+
+/**
+ * Fixed-size bump allocator in internal RAM (.bss), used for task stacks and queue storage
+ * when CONFIG_STATIC_ALLOCATION is set. Memory is never returned - objects using it are
+ * expected to live for the whole runtime.
+ */
+class StaticArena {
+public:
+	/**
+	 * Aborts if the arena is exhausted, so a misconfigured build fails deterministically at boot.
+	 * @param size number of bytes
+	 * @param align alignment of the returned pointer, must be a power of 2
+	 */
+	static void* alloc(size_t size, size_t align = 8);
+
+	static size_t used();
+	static constexpr size_t capacity(){ return Size; }
+
+private:
+	static constexpr size_t Size = CONFIG_STATIC_ARENA_SIZE;
+	static size_t head;
+};
+
+#endif
+
+#endif //THUNDER_DETECTOR_STATICARENA_H
@@ -1,9 +1,21 @@
 #include "Threaded.h"
+#include "StaticArena.h"
+#include "Instrumentation.h"
 #include <esp_log.h>
 
 Threaded::Threaded(const char* name, size_t stackSize, uint8_t priority, int8_t core) : name(name), stackSize(stackSize), priority(priority), core(core){
+#ifdef CONFIG_STATIC_ALLOCATION
+	stack = (StackType_t*) StaticArena::alloc(stackSize, 16);
+	stopSem = xSemaphoreCreateBinaryStatic(&stopSemBuffer);
+	stopMut = xSemaphoreCreateMutexStatic(&stopMutBuffer);
+	taskMut = xSemaphoreCreateMutexStatic(&taskMutBuffer);
+#else
 	stopSem = xSemaphoreCreateBinary();
 	stopMut = xSemaphoreCreateMutex();
+	taskMut = xSemaphoreCreateMutex();
+#endif
+
+	Instrumentation::add(this);
 }
 
 Threaded::~Threaded(){
@@ -12,8 +24,15 @@ Threaded::~Threaded(){
 		abort();
 	}
 
+	Instrumentation::remove(this);
+
+#ifdef CONFIG_STATIC_ALLOCATION
+	reclaim();
+#endif
+
 	vSemaphoreDelete(stopSem);
 	vSemaphoreDelete(stopMut);
+	vSemaphoreDelete(taskMut);
 }
 
 void Threaded::start(){
@@ -23,11 +42,17 @@ void Threaded::start(){
 
 	state = Running;
 
+#ifdef CONFIG_STATIC_ALLOCATION
+	//stack and TCB are reused on every start, nothing is allocated here
+	reclaim();
+	task = xTaskCreateStaticPinnedToCore(Threaded::threadFunc, name, stackSize, this, priority, stack, &taskBuffer, core == -1 ? tskNO_AFFINITY : core);
+#else
 	if(core == -1){
 		xTaskCreate(Threaded::threadFunc, name, stackSize, this, priority, &task);
 	}else{
 		xTaskCreatePinnedToCore(Threaded::threadFunc, name, stackSize, this, priority, &task, core);
 	}
+#endif
 }
 
 void Threaded::stop(TickType_t wait){
@@ -47,6 +72,11 @@ void Threaded::stop(TickType_t wait){
 	xSemaphoreGive(stopMut);
 }
 
+void Threaded::step(){
+	if(state != Stopped) return;
+	loop();
+}
+
 void Threaded::threadFunc(void* arg){
 	auto thr = static_cast<Threaded*>(arg);
 
@@ -56,11 +86,36 @@ void Threaded::threadFunc(void* arg){
 
 	thr->onStop();
 
+	//withTask() callers are done with the handle before it is cleared, and don't get it after
+	xSemaphoreTake(thr->taskMut, portMAX_DELAY);
+#ifdef CONFIG_STATIC_ALLOCATION
+	thr->endedTask = thr->task;
+#endif
+	thr->task = nullptr;
+	xSemaphoreGive(thr->taskMut);
 	thr->state = Stopped;
 	xSemaphoreGive(thr->stopSem);
 
+#ifdef CONFIG_STATIC_ALLOCATION
+	//a self-deleted task waits for the idle task in the termination list, there's no telling when its TCB is free
+	vTaskSuspend(nullptr);
+#else
 	vTaskDelete(nullptr);
+#endif
+}
+
+#ifdef CONFIG_STATIC_ALLOCATION
+void Threaded::reclaim(){
+	if(endedTask == nullptr) return;
+
+	//eSuspended only once it has also switched out, a task deleted while not running is unlinked right away
+	while(eTaskGetState(endedTask) != eSuspended){
+		vTaskDelay(1);
+	}
+	vTaskDelete(endedTask);
+	endedTask = nullptr;
 }
+#endif
 
 bool Threaded::onStart(){
 	return true;
@@ -76,6 +131,14 @@ bool Threaded::running(){
 	return state == Running || state == Stopping;
 }
 
+const char* Threaded::getName() const{
+	return name;
+}
+
+TaskHandle_t Threaded::getTask() const{
+	return task;
+}
+
 ThreadedClosure::ThreadedClosure(Lambda loopFn, const char* name, size_t stackSize, uint8_t priority, int8_t core) : Threaded(name, stackSize, priority, core), fn(std::move(loopFn)){}
 
 void ThreadedClosure::loop(){
@@ -6,6 +6,7 @@
 #include <freertos/task.h>
 #include <freertos/semphr.h>
 #include <functional>
+#include <sdkconfig.h>
 
 class Threaded {
 public:
@@ -14,8 +15,30 @@ public:
 	void start();
 	void stop(TickType_t wait = portMAX_DELAY);
 
+	/**
+	 * Runs a single loop() iteration on the calling task instead of the own thread, for deterministic
+	 * replay on host. Must not be used while the thread is running.
+	 */
+	void step();
+
 	bool running();
 
+	const char* getName() const;
+	TaskHandle_t getTask() const;
+
+	/**
+	 * Calls 'fn' with the task's handle, the task can't end and free its TCB until 'fn' returns.
+	 * Not called when the task isn't running.
+	 */
+	template<typename F>
+	void withTask(F fn){
+		xSemaphoreTake(taskMut, portMAX_DELAY);
+		if(task){
+			fn(task);
+		}
+		xSemaphoreGive(taskMut);
+	}
+
 protected:
 	Threaded(const char* name, size_t stackSize = 12000, uint8_t priority = 5, int8_t core = -1);
 
@@ -38,9 +61,22 @@ private:
 	} state = Stopped;
 
 	static void threadFunc(void* arg);
-	TaskHandle_t task;
+	TaskHandle_t task = nullptr;
 	SemaphoreHandle_t stopSem;
 	SemaphoreHandle_t stopMut;
+	SemaphoreHandle_t taskMut; //held while 'task' is cleared at the end of the thread
+
+#ifdef CONFIG_STATIC_ALLOCATION
+	StackType_t* stack;
+	StaticTask_t taskBuffer;
+	TaskHandle_t endedTask = nullptr; //suspended at its end, still on 'stack' and 'taskBuffer' until reclaimed
+
+	//Waits until the ended task is off the CPU and deletes it, so the TCB and stack are out of the kernel's lists
+	void reclaim();
+	StaticSemaphore_t stopSemBuffer;
+	StaticSemaphore_t stopMutBuffer;
+	StaticSemaphore_t taskMutBuffer;
+#endif
 
 };
 
@@ -0,0 +1,92 @@
+#include "TileStream.h"
+#include <algorithm>
+#include <cstring>
+
+#ifdef ESP_PLATFORM
+#include <soc/soc_caps.h>
+#endif
+
+#if defined(ESP_PLATFORM) && SOC_AHB_GDMA_SUPPORT_PSRAM
+#define TILE_DMA
+
+#include <esp_async_memcpy.h>
+#include <esp_attr.h>
+#include <esp_log.h>
+
+static const char* TAG = "TileStream";
+
+//one driver for every stream, installed with the first
+static async_memcpy_handle_t driver = nullptr;
+static bool installed = false;
+
+static bool IRAM_ATTR copied(async_memcpy_handle_t, async_memcpy_event_t*, void* ready){
+	((std::atomic<bool>*) ready)->store(true);
+	return false;
+}
+#endif
+
+TileStream::TileStream(size_t rowBytes, size_t tileRows, const char* owner) : rowBytes(rowBytes), tileRows(tileRows),
+																			  tiles(Memory::Region::Dma, 2 * rowBytes * tileRows, owner){
+#ifdef TILE_DMA
+	if(!installed){
+		installed = true;
+
+		async_memcpy_config_t config = ASYNC_MEMCPY_DEFAULT_CONFIG();
+		config.backlog = 2;
+		config.psram_trans_align = DmaAlign;
+		if(esp_async_memcpy_install(&config, &driver) != ESP_OK){
+			ESP_LOGW(TAG, "no async memcpy, tiles are copied by the CPU");
+			driver = nullptr;
+		}
+	}
+#endif
+}
+
+void TileStream::start(const uint8_t* src, size_t rows){
+	this->src = src;
+	this->rows = tiles.size() ? rows : 0;
+	delivered = 0;
+	current = 0;
+
+	if(this->rows > 0){
+		copy(0, 0);
+	}
+}
+
+const uint8_t* TileStream::next(size_t& rows){
+	if(delivered >= this->rows) return nullptr;
+
+	//the copy started with the previous tile is usually long done
+	while(!ready[current].load()){}
+
+	rows = tileSize(delivered);
+	if(delivered + rows < this->rows){
+		copy(current ^ 1, delivered + rows);
+	}
+
+	const uint8_t* out = tile(current);
+	delivered += rows;
+	current ^= 1;
+	return out;
+}
+
+size_t TileStream::tileSize(size_t firstRow) const{
+	return std::min(tileRows, rows - firstRow);
+}
+
+void TileStream::copy(uint8_t index, size_t firstRow){
+	uint8_t* dst = tile(index);
+	const uint8_t* from = src + firstRow * rowBytes;
+	const size_t size = tileSize(firstRow) * rowBytes;
+	ready[index] = false;
+
+#ifdef TILE_DMA
+	if(driver && (uintptr_t) from % DmaAlign == 0 && size % DmaAlign == 0 &&
+	   esp_async_memcpy(driver, dst, (void*) from, size, copied, &ready[index]) == ESP_OK){
+		return;
+	}
+#endif
+
+	memcpy(dst, from, size);
+	ready[index] = true;
+}
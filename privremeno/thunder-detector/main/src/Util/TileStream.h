@@ -0,0 +1,49 @@
+#ifndef THUNDER_DETECTOR_TILESTREAM_H
+#define THUNDER_DETECTOR_TILESTREAM_H
+
+#include "Memory.h"
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+
+/**
+ * Reads a frame in PSRAM (camera frame buffers) through two tiles of rows in internal RAM: while one tile is
+ * processed, the GDMA (esp_async_memcpy) copies the next one into the other. The CPU then only touches internal
+ * RAM and never waits on PSRAM cache misses. Sources the DMA can't take (unaligned) and the host use memcpy.
+ */
+class TileStream {
+public:
+	TileStream(size_t rowBytes, size_t tileRows, const char* owner);
+
+	//Starts copying the first tile of the 'rows' rows at 'src'
+	void start(const uint8_t* src, size_t rows);
+
+	/**
+	 * Waits for the current tile and starts copying the one after it. The previous tile is reused for that, so
+	 * it has to be processed before calling this again.
+	 * @param rows receives the number of rows in the tile
+	 * @return nullptr past the last row
+	 */
+	const uint8_t* next(size_t& rows);
+
+	//GDMA transfers from PSRAM need the address and size aligned to this
+	static constexpr size_t DmaAlign = 64;
+
+private:
+	const size_t rowBytes;
+	const size_t tileRows;
+	RegionBuffer<uint8_t> tiles; //both tiles, DMA-capable
+
+	const uint8_t* src = nullptr;
+	size_t rows = 0;
+	size_t delivered = 0; //rows returned by next() so far
+	uint8_t current = 0;
+	std::atomic<bool> ready[2] = {};
+
+	uint8_t* tile(uint8_t index){ return tiles.data() + index * rowBytes * tileRows; }
+	size_t tileSize(size_t firstRow) const;
+	void copy(uint8_t index, size_t firstRow);
+};
+
+
+#endif //THUNDER_DETECTOR_TILESTREAM_H
@@ -1,10 +1,50 @@
 #include "Timer.h"
 #include <esp_timer.h>
 
+#ifdef ESP_PLATFORM
+#include <esp_cpu.h>
+#include <sdkconfig.h>
+
+uint32_t microsPerCycleQ32 = (1ull << 32) / CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+#else
+#include <ctime>
+
+uint32_t microsPerCycleQ32 = (1ull << 32) / 1000;
+#endif
+
 uint64_t millis(){
 	return micros() / 1000;
 }
 
 uint64_t micros(){
 	return esp_timer_get_time();
-}
\ No newline at end of file
+}
+
+uint32_t cycles(){
+#ifdef ESP_PLATFORM
+	return esp_cpu_get_cycle_count();
+#else
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+void calibrateCycles(){
+#ifdef ESP_PLATFORM
+	static constexpr int64_t Window = 2000; //[us]
+
+	//align to an esp_timer tick so the window isn't shortened by a partial microsecond
+	const int64_t edge = esp_timer_get_time();
+	int64_t t0;
+	while((t0 = esp_timer_get_time()) == edge);
+	const uint32_t c0 = esp_cpu_get_cycle_count();
+
+	int64_t t1;
+	while((t1 = esp_timer_get_time()) - t0 < Window);
+	const uint32_t c1 = esp_cpu_get_cycle_count();
+
+	microsPerCycleQ32 = ((uint64_t) (t1 - t0) << 32) / (c1 - c0);
+#endif
+	//host counter is already in nanoseconds
+}
@@ -6,5 +6,54 @@
 uint64_t millis();
 uint64_t micros();
 
+/**
+ * Raw cycle counter of the calling core (CCOUNT on ESP32, nanoseconds of CLOCK_MONOTONIC on host).
+ * Wraps around every 2^32 cycles (~17.9 s at 240 MHz, ~4.3 s on host) and is not synchronised
+ * between cores, so only use it for short intervals measured on one task.
+ */
+uint32_t cycles();
+
+/**
+ * Measures the cycle counter rate against esp_timer (~2 ms busy wait). Until called, conversions
+ * assume CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ.
+ */
+void calibrateCycles();
+
+//Q32 fixed-point microseconds per cycle, set by calibrateCycles()
+extern uint32_t microsPerCycleQ32;
+
+inline uint32_t cyclesToMicros(uint32_t c){
+	return ((uint64_t) c * microsPerCycleQ32) >> 32;
+}
+
+/**
+ * Cycle-counter stopwatch for profiling. Optionally writes the elapsed microseconds to 'result'
+ * when it goes out of scope.
+ */
+class Stopwatch {
+public:
+	Stopwatch(uint32_t* result = nullptr) : result(result), start(cycles()){}
+
+	~Stopwatch(){
+		if(result) *result = elapsedMicros();
+	}
+
+	void reset(){
+		start = cycles();
+	}
+
+	uint32_t elapsedCycles() const{
+		return cycles() - start;
+	}
+
+	uint32_t elapsedMicros() const{
+		return cyclesToMicros(elapsedCycles());
+	}
+
+private:
+	uint32_t* const result;
+	uint32_t start;
+};
+
 
 #endif //THUNDER_DETECTOR_TIMER_H
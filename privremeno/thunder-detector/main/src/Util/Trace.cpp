@@ -0,0 +1,125 @@
+#include "Trace.h"
+
+#ifdef CONFIG_TRACE
+
+#include "Threaded.h"
+#include "Timer.h"
+#include <esp_timer.h>
+#include <esp_log.h>
+#include <cstdio>
+#include <algorithm>
+
+#ifdef CONFIG_TRACE_OUTPUT_SD
+#include "Periph/SDWriter.h"
+#else
+#include <driver/uart.h>
+#endif
+
+static const char* TAG = "Trace";
+
+static constexpr uint32_t FlushPeriod = 250; //[ms]
+static constexpr size_t ChunkRecords = 64;
+
+Trace::Buffer Trace::buffers[portNUM_PROCESSORS] = {};
+
+#ifdef CONFIG_TRACE_OUTPUT_SD
+static SDWriter* file = nullptr;
+#endif
+
+void Trace::start(){
+#ifdef CONFIG_TRACE_OUTPUT_SD
+	file = new SDWriter(4096);
+	if(!file->open("/sd/trace.bin")){
+		ESP_LOGE(TAG, "error opening trace file on SD!");
+		return;
+	}
+#else
+	const uart_config_t cfg = {
+			.baud_rate = CONFIG_TRACE_UART_BAUD,
+			.data_bits = UART_DATA_8_BITS,
+			.parity = UART_PARITY_DISABLE,
+			.stop_bits = UART_STOP_BITS_1,
+			.flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+			.source_clk = UART_SCLK_DEFAULT,
+	};
+	ESP_ERROR_CHECK(uart_driver_install((uart_port_t) CONFIG_TRACE_UART_NUM, 256, 4096, 0, nullptr, 0));
+	ESP_ERROR_CHECK(uart_param_config((uart_port_t) CONFIG_TRACE_UART_NUM, &cfg));
+	ESP_ERROR_CHECK(uart_set_pin((uart_port_t) CONFIG_TRACE_UART_NUM, CONFIG_TRACE_UART_TX_GPIO, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+#endif
+
+	write(&TraceHeaderDefault, sizeof(TraceHeaderDefault));
+
+	static ThreadedClosure thread(&Trace::loop, "TraceFlush", 3 * 1024, 1);
+	thread.start();
+}
+
+void IRAM_ATTR Trace::record(TraceId id, TraceType type, uint32_t arg){
+	//masking interrupts keeps the task on this core and makes the slot write atomic against preemption
+	const auto irq = portSET_INTERRUPT_MASK_FROM_ISR();
+	//stamped inside the mask so the ring stays in time order; esp_timer_get_time is in IRAM, micros() isn't
+	const auto timestamp = (uint64_t) esp_timer_get_time();
+	const auto core = xPortGetCoreID();
+	auto& buf = buffers[core];
+
+	const uint32_t head = buf.head.load(std::memory_order_relaxed);
+	buf.records[head & (Size - 1)] = { timestamp, id, type, (uint8_t) core, arg };
+	buf.head.store(head + 1, std::memory_order_release);
+
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+}
+
+void Trace::loop(){
+	vTaskDelay(pdMS_TO_TICKS(FlushPeriod));
+	flush();
+}
+
+void Trace::flush(){
+	static TraceRecord chunk[ChunkRecords];
+
+	for(uint8_t core = 0; core < portNUM_PROCESSORS; core++){
+		auto& buf = buffers[core];
+		uint32_t dropped = 0;
+
+		const uint32_t head = buf.head.load(std::memory_order_acquire);
+		if(head - buf.tail > Size){
+			dropped += head - buf.tail - Size;
+			buf.tail = head - Size;
+		}
+
+		while(buf.tail != head){
+			const size_t count = std::min<size_t>(head - buf.tail, ChunkRecords);
+			for(size_t i = 0; i < count; i++){
+				chunk[i] = buf.records[(buf.tail + i) & (Size - 1)];
+			}
+
+			//the writer may have lapped us while copying, those slots are torn
+			const uint32_t now = buf.head.load(std::memory_order_acquire);
+			const size_t torn = now - buf.tail > Size ? std::min<size_t>(now - buf.tail - Size, count) : 0;
+
+			if(count > torn){
+				write(chunk + torn, (count - torn) * sizeof(TraceRecord));
+			}
+			dropped += torn;
+			buf.tail += count;
+		}
+
+		if(dropped){
+			const TraceRecord record = { micros(), TraceId::Dropped, TraceType::Instant, core, dropped };
+			write(&record, sizeof(record));
+		}
+	}
+
+#ifdef CONFIG_TRACE_OUTPUT_SD
+	file->flush();
+#endif
+}
+
+void Trace::write(const void* data, size_t size){
+#ifdef CONFIG_TRACE_OUTPUT_SD
+	file->write(data, size);
+#else
+	uart_write_bytes((uart_port_t) CONFIG_TRACE_UART_NUM, data, size);
+#endif
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef THUNDER_DETECTOR_TRACE_H
+#define THUNDER_DETECTOR_TRACE_H
+
+#include <cstddef>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <sdkconfig.h>
+#include "TraceFormat.h"
+
+#ifdef CONFIG_TRACE
+
+/**
+ * Per-core ring buffers of binary trace records. Writers only touch the buffer of the core they run on,
+ * with interrupts masked for the few instructions of the store, so there are no locks between cores.
+ * A low-priority task drains the buffers to SD or UART; records overwritten before being drained
+ * are reported with a TraceId::Dropped instant event.
+ */
+class Trace {
+public:
+	static void start();
+
+	static void begin(TraceId id, uint32_t arg = 0){ record(id, TraceType::Begin, arg); }
+	static void end(TraceId id, uint32_t arg = 0){ record(id, TraceType::End, arg); }
+	static void instant(TraceId id, uint32_t arg = 0){ record(id, TraceType::Instant, arg); }
+	static void counter(TraceId id, uint32_t value){ record(id, TraceType::Counter, value); }
+
+	static void record(TraceId id, TraceType type, uint32_t arg);
+
+	static constexpr size_t Size = CONFIG_TRACE_BUFFER_RECORDS;
+	static_assert((Size & (Size - 1)) == 0, "CONFIG_TRACE_BUFFER_RECORDS must be a power of 2");
+
+private:
+	struct Buffer {
+		TraceRecord records[Size];
+		std::atomic<uint32_t> head; //written only by the owning core
+		uint32_t tail; //read position, flush task only
+	};
+
+	static Buffer buffers[portNUM_PROCESSORS];
+
+	static void loop();
+	static void flush();
+	static void write(const void* data, size_t size);
+};
+
+#else
+
+class Trace {
+public:
+	static void start(){}
+	static void begin(TraceId, uint32_t = 0){}
+	static void end(TraceId, uint32_t = 0){}
+	static void instant(TraceId, uint32_t = 0){}
+	static void counter(TraceId, uint32_t){}
+};
+
+#endif
+
+/**
+ * Records a begin event on construction and the matching end event on destruction.
+ */
+class TraceSpan {
+public:
+	TraceSpan(TraceId id, uint32_t arg = 0) : id(id){
+		Trace::begin(id, arg);
+	}
+
+	~TraceSpan(){
+		Trace::end(id);
+	}
+
+private:
+	const TraceId id;
+};
+
+#endif //THUNDER_DETECTOR_TRACE_H
@@ -0,0 +1,65 @@
+#ifndef THUNDER_DETECTOR_TRACEFORMAT_H
+#define THUNDER_DETECTOR_TRACEFORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+
+//Binary trace dump format, shared between the firmware and host/tools/trace2json.
+//A dump is a TraceHeader followed by TraceRecords, per-core chunks interleaved in flush order.
+
+enum class TraceId : uint16_t {
+	FrameGet,
+	Detection,
+	StoreShots,
+	AudioRead,
+	ClapDetect,
+	QueuePost,
+	QueueGet,
+	SDWrite,
+	Dropped, //instant, arg = number of records lost to buffer overrun
+	FrameEncode, //arg = coded bytes
+	JpegDc, //arg = JPEG bytes
+	CameraSwitch, //arg = frame divider
+	Components, //arg = connected regions of the change
+	Count
+};
+
+static constexpr const char* TraceNames[] = {
+		"FrameGet",
+		"Detection",
+		"StoreShots",
+		"AudioRead",
+		"ClapDetect",
+		"QueuePost",
+		"QueueGet",
+		"SDWrite",
+		"Dropped",
+		"FrameEncode",
+		"JpegDc",
+		"CameraSwitch",
+		"Components"
+};
+static_assert(sizeof(TraceNames) / sizeof(TraceNames[0]) == (size_t) TraceId::Count);
+
+enum class TraceType : uint8_t {
+	Begin, End, Instant, Counter
+};
+
+struct TraceRecord {
+	uint64_t timestamp; //[us], micros()
+	TraceId id;
+	TraceType type;
+	uint8_t core;
+	uint32_t arg;
+};
+static_assert(sizeof(TraceRecord) == 16);
+
+struct TraceHeader {
+	char magic[4]; //"THTR"
+	uint16_t version;
+	uint16_t recordSize;
+};
+
+static constexpr TraceHeader TraceHeaderDefault = { { 'T', 'H', 'T', 'R' }, 1, sizeof(TraceRecord) };
+
+#endif //THUNDER_DETECTOR_TRACEFORMAT_H
@@ -1,50 +1,93 @@
 #include "VisualDetector.h"
 #include "Util/Timer.h"
+#include "Util/Trace.h"
+#include "Util/DeferredLog.h"
+#include "RingLog.h"
+#include "FrameLog.h"
 #include <esp_log.h>
+#include <esp_heap_caps.h>
+#include <cinttypes>
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <string>
 
-#undef EPS
+static const char* TAG = "VideoDetect";
 
-#include <opencv2/imgproc.hpp>
+VisualDetector::VisualDetector(FrameSource* cam, Queue<SensorEvent>* queue) : Threaded("VideoDetect", 12 * 1024, 5, 0), camera(cam), outputQueue(queue),
+																				 grayFrame(Memory::Region::Hot, FrameWidth * FrameHeight, "gray frame"),
+																				 background(Memory::Region::Hot, FrameWidth * FrameHeight, "background"),
+																				 changeMask(Memory::Region::Bulk, FrameWidth * FrameHeight, "change mask"),
+																				 changes(FrameHeight), previousChanges(FrameHeight){
+	setParams(params);
+}
 
-static const char* TAG = "VideoDetect";
+void VisualDetector::setStoreShots(bool store){
+	storeEnabled = store;
+}
 
-VisualDetector::VisualDetector(Camera* cam, Queue<SensorEvent>* queue) : Threaded("VideoDetect", 12 * 1024, 5, 0), camera(cam), outputQueue(queue){
+void VisualDetector::setParams(const Params& params){
+	this->params = params;
+	applyScene();
+}
+
+void VisualDetector::setBurst(uint8_t idleDivider, uint32_t duration){
+	this->idleDivider = std::max<uint8_t>(idleDivider, 1);
+	burstDuration = duration;
+}
+
+const VisualDetector::Params& VisualDetector::getParams() const{
+	return params;
+}
 
-	frame0Data = std::unique_ptr<uint8_t>((uint8_t*) heap_caps_malloc(ScaledWidth * ScaledHeight, MALLOC_CAP_SPIRAM));
-	frame1Data = std::unique_ptr<uint8_t>((uint8_t*) heap_caps_malloc(ScaledWidth * ScaledHeight, MALLOC_CAP_SPIRAM));
+const VisualDetector::Params& VisualDetector::getTuned() const{
+	return tuned;
+}
 
-	frame0 = cv::Mat(ScaledHeight, ScaledWidth, CV_8U, frame0Data.get());
-	frame1 = cv::Mat(ScaledHeight, ScaledWidth, CV_8U, frame1Data.get());
+SceneCalibration::Scene VisualDetector::getScene() const{
+	return calibration.getScene();
 }
 
 void VisualDetector::loop(){
 
-	const auto start = millis();
+	Stopwatch frameTime;
 
-	lastShotTimestamp = millis();
+	Trace::begin(TraceId::FrameGet);
 	camera_fb_t* frameData = camera->getFrame();
+	Trace::end(TraceId::FrameGet);
 	if(frameData == nullptr || frameData->buf == nullptr || frameData->len == 0){
-		ESP_LOGE(TAG, "Camera getFrame fail!");
+		DLOGE(TAG, "Camera getFrame fail!");
 		camera->releaseFrame();
 		return;
 	}
 
-	const auto frameGet = millis() - start;
+	const auto frameGet = frameTime.elapsedMicros();
 
+	Trace::begin(TraceId::Detection);
 	const auto intensity = detectLightning(frameData);
+	Trace::end(TraceId::Detection, intensity);
 
-	if(intensity > 0){
-		storeShots();
+	//a change lasting several frames is reported once, its later frames would overwrite the flash in Fusion
+	if(intensity > 0 && armed){
+		armed = false;
+		if(storeEnabled){
+			storeShots(frameData);
+		}
 		if(outputQueue){
-			SensorEvent event{ SensorEvent::Type::Video, lastShotTimestamp, { .video = { (uint8_t) intensity }}};
+			SensorEvent event{ SensorEvent::Type::Video, flashTimestamp, { .video = change }};
+			Trace::instant(TraceId::QueuePost, (uint32_t) event.type);
 			outputQueue->post(event, portMAX_DELAY);
 		}
+	}else if(intensity == 0){
+		armed = true;
 	}
 
-	const auto total = millis() - start;
+	updateRate(intensity > 0);
+
+	const auto total = frameTime.elapsedMicros();
 	const auto detection = total - frameGet;
 
-	ESP_LOGD(TAG, "frame get: %llums, detection: %llums, total: %llums, fps: %.2f", frameGet, detection, total, 1000.0f / (float) total);
+	DLOGD(TAG, "frame get: %" PRIu32 "us, detection: %" PRIu32 "us, total: %" PRIu32 "us, fps: %.2f", frameGet, detection, total, 1000000.0f / (float) total);
 
 	camera->releaseFrame();
 
@@ -53,12 +96,211 @@ void VisualDetector::loop(){
 }
 
 int VisualDetector::detectLightning(camera_fb_t* frameData){
-	const uint8_t* rawFrame = frameData->buf;
-	std::vector<uint8_t> grayFrame(FrameWidth * FrameHeight);
+	uint8_t* gray = grayFrame.data();
+
+	//frame logs replayed on host are grayscale already
+	if(frameData->format == PIXFORMAT_GRAYSCALE){
+		memcpy(gray, frameData->buf, std::min(frameData->len, grayFrame.size()));
+		gatherFeatures(gray, features);
+	}else if(frameData->format == PIXFORMAT_JPEG){
+		if(!jpegToGray(frameData, gray)) return 0;
+		gatherFeatures(gray, features);
+	}else{
+		//the next tile is copied while this one is converted
+		tiles.start(frameData->buf, FrameHeight);
+		size_t y = 0, rows;
+		while(const uint8_t* tile = tiles.next(rows)){
+			rgb565ToGray(tile, gray + y * FrameWidth, features, y, rows);
+			y += rows;
+		}
+	}
+
+	trackFrameTime(frameData);
+	FrameLog::frame(frameStart, gray);
+
+	//Need an initial background to start comparison, and a new one after the sensor profile changed
+	if(!initialFill || settleFrames > 0){
+		initialFill = true;
+		if(settleFrames > 0){
+			settleFrames--;
+		}
+		initBackground(gray, background.data(), background.size());
+		updateReference(features, reference, 0);
+		detectedFrames = 0;
+		return 0;
+	}
+
+	std::swap(changes, previousChanges);
+	rowChanges(features, reference, changes.data());
+
+	uint32_t sum;
+	const uint8_t quietShift = std::max(0, tuned.backgroundShift - QuietShift);
+
+	//quiet frames only keep the background up to date, a few rows at a time
+	if(tuned.gates && !gate(features, reference, tuned)){
+		detectedFrames = 0;
+		updateReference(features, reference, quietShift);
+		calibrate();
+
+		Params quiet = tuned;
+		quiet.backgroundShift = quietShift;
+		for(size_t y = quietFrames++ % QuietRowStride; y < FrameHeight; y += QuietRowStride){
+			updateBackground(gray + y * FrameWidth, background.data() + y * FrameWidth, FrameWidth, quiet, sum);
+		}
+		return 0;
+	}
+
+	const bool lasting = detectedFrames >= LastingFrames;
+	const auto count = updateBackground(gray, background.data(), background.size(), tuned, sum, changeMask.data(), lasting);
+	DLOGD(TAG, "Diff pixel count: %" PRIu32, count);
+
+	//like the background, the reference doesn't follow a flash
+	const bool detected = count >= detectionPixelNum;
+	updateReference(features, reference, detected && !lasting ? tuned.backgroundShift + ForegroundShift : quietShift);
+
+	if(!detected){
+		detectedFrames = 0;
+		calibrate();
+		return 0;
+	}
+	detectedFrames++;
+
+	//a flash over a lasting change, e.g. headlights, gets an event of its own
+	if(lasting && count >= FlashGrowth * previousCount){
+		armed = true;
+	}
+	previousCount = count;
+
+	flashTimestamp = flashTime();
+	DLOGD(TAG, "Flash at %" PRId64 " us from the frame start", (int64_t) (flashTimestamp - frameStart));
+
+	const int intensity = (int) (sum / count);
+	if(changeMask.size()){
+		Trace::begin(TraceId::Components);
+		describeChange(ImageView(changeMask.data(), FrameWidth, FrameHeight), changeCells, labeller, change);
+		Trace::end(TraceId::Components, change.regions);
+	}
+	change.intensity = intensity;
+	DLOGD(TAG, "Change: %u regions, %u/255 of the frame, largest %u,%u-%u,%u elongated %.1f", change.regions, change.coverage,
+		  change.left, change.top, change.right, change.bottom, change.elongation);
+
+	return intensity;
+}
+
+void VisualDetector::calibrate(){
+	if(!params.calibrate) return;
+
+	uint64_t total = 0;
+	for(const auto row : features.rows){
+		total += row;
+	}
+	const float luminance = (float) total / (FrameWidth * FrameHeight);
+
+	//a row mean against the reference varies by the pixel noise / sqrt(width). Taken from the median row, headlights or
+	//a lit patch under the area threshold would read as noise and raise the cutoff over the next flash.
+	float deviations[FrameHeight];
+	for(size_t y = 0; y < FrameHeight; y++){
+		deviations[y] = std::abs(changes[y]);
+	}
+	std::nth_element(deviations, deviations + FrameHeight / 2, deviations + FrameHeight);
+	const float noise = deviations[FrameHeight / 2] / MedianDeviation * std::sqrt((float) FrameWidth);
+
+	float time, gain;
+	if(calibrationFrames++ % ExposurePeriod == 0 && camera->getExposure(time, gain)){
+		exposureScale = std::max(time * gain, 0.001f);
+	}
+
+	if(calibration.update(luminance / exposureScale, noise)){
+		const auto scene = calibration.getScene();
+		DLOGI(TAG, "Scene %s: level %.1f, noise %.2f", SceneCalibration::name(scene), calibration.getLevel(), calibration.getNoise());
+
+		if(camera->setProfile(Profiles[(size_t) scene].sensor)){
+			settleFrames = SettleFrames;
+		}
+	}
+	applyScene();
+}
+
+void VisualDetector::applyScene(){
+	tuned = params;
+	if(params.calibrate){
+		const auto& profile = Profiles[(size_t) calibration.getScene()];
+		const float cutoff = std::max(params.noiseCutoff * profile.cutoffScale, calibration.getNoise() * NoiseCutoffFactor);
+		tuned.noiseCutoff = (uint8_t) std::clamp<float>(std::round(cutoff), 1, UINT8_MAX);
+	}
+	detectionPixelNum = FrameHeight * FrameWidth * tuned.detectionThreshold;
+}
+
+void VisualDetector::trackFrameTime(const camera_fb_t* frameData){
+	const uint64_t time = camera->frameTime(frameData);
+
+	if(frameStart > dividerSwitched && time > frameStart){
+		const uint32_t spacing = std::min<uint64_t>(time - frameStart, UINT32_MAX);
+		windowPeriod = std::min(windowPeriod, spacing);
+		if(framePeriod == 0 || spacing < framePeriod){
+			framePeriod = spacing;
+		}
+
+		//restarted every window, so it also follows the sensor lowering the frame rate in the dark
+		if(++windowFrames >= PeriodWindow){
+			framePeriod = windowPeriod;
+			windowPeriod = UINT32_MAX;
+			windowFrames = 0;
+		}
+	}
+
+	previousFrameStart = frameStart;
+	frameStart = time;
+}
+
+uint64_t VisualDetector::flashTime() const{
+	if(framePeriod == 0) return frameStart;
+
+	//a quarter of the strongest change, two rows over it so one noisy row doesn't start a band
+	float peak = 0;
+	for(size_t y = 0; y + 1 < FrameHeight; y++){
+		peak = std::max(peak, std::min(changes[y], changes[y + 1]));
+	}
+	const float level = std::max(peak / 4, OnsetFloor);
+	//a longer period between bursts is only blanking, the rows are read out as fast
+	const float rowTime = framePeriod * ReadoutShare / (FrameHeight * frameDivider); //[us]
+
+	int32_t row = findBand(changes.data(), FrameHeight, level, false);
+	if(row != 0) return frameStart + (uint64_t) (std::max(row, 0) * rowTime);
+
+	row = findBand(previousChanges.data(), FrameHeight, level, true);
+	if(row < 0 || previousFrameStart == 0) return frameStart;
+	return previousFrameStart + (uint64_t) (row * rowTime);
+}
+
+bool VisualDetector::jpegToGray(const camera_fb_t* frameData, uint8_t* gray){
+	//11 kB of Huffman tables looked up for every code, under the size malloc puts into PSRAM
+	if(!jpegDc){
+		jpegDc = std::make_unique<JpegDcDecoder>();
+	}
+
+	Trace::begin(TraceId::JpegDc);
+	const bool decoded = jpegDc->decode(frameData->buf, frameData->len);
+	Trace::end(TraceId::JpegDc, frameData->len);
+	if(!decoded){
+		DLOGE(TAG, "JPEG DC decode fail!");
+		return false;
+	}
 
-	//RGB565 format to 8-bit grayscale
-	for(size_t i = 0; i < grayFrame.size(); ++i){
-		uint16_t color = ((uint16_t*) rawFrame)[i];
+	//one pixel per 8x8 block, VGA gives 80x60
+	const ImageView blocks(jpegDc->getPixels(), jpegDc->getWidth(), jpegDc->getHeight());
+	const ImageView out(gray, FrameWidth, FrameHeight);
+	if(blocks.sameSize(out)){
+		Image::copy(blocks, out);
+	}else{
+		scale(blocks, out);
+	}
+	return true;
+}
+
+void VisualDetector::rgb565ToGray(const uint8_t* rgb565, uint8_t* gray, size_t pixels){
+	for(size_t i = 0; i < pixels; ++i){
+		uint16_t color = ((const uint16_t*) rgb565)[i];
 		color = (color >> 8) | (color << 8);
 
 		uint8_t r = (color & 0xF800) >> 11;
@@ -69,74 +311,266 @@ int VisualDetector::detectLightning(camera_fb_t* frameData){
 		g = std::clamp((g * 255) / 63, 0, 255);
 		b = std::clamp((b * 255) / 31, 0, 255);
 
-		grayFrame[i] = (r + g + b) / 3;
+		gray[i] = (r + g + b) / 3;
 	}
+}
 
+void VisualDetector::rgb565ToGray(const uint8_t* rgb565, uint8_t* gray, FrameFeatures& features){
+	rgb565ToGray(rgb565, gray, features, 0, features.height);
+}
 
-	const cv::Mat gray(FrameHeight, FrameWidth, CV_8U, grayFrame.data());
+void VisualDetector::rgb565ToGray(const uint8_t* rgb565, uint8_t* gray, FrameFeatures& features, size_t firstRow, size_t rows){
+	if(firstRow == 0){
+		memset(features.histogram, 0, sizeof(features.histogram));
+		std::fill(features.columns.begin(), features.columns.end(), 0);
+	}
 
-	//Need to fill initial frame buffer to start comparison
-	if(!initialFill){
-		initialFill = true;
-		cv::resize(gray, frame0, frame0.size(), 0, 0, cv::InterpolationFlags::INTER_LINEAR);
-		return 0;
+	for(size_t y = 0; y < rows; y++){
+		const size_t row = y * features.width;
+		rgb565ToGray(rgb565 + row * 2, gray + row, features.width);
+
+		//the row was just written, it is read back from the cache
+		uint32_t sum = 0;
+		for(size_t x = 0; x < features.width; x++){
+			const uint8_t value = gray[row + x];
+			sum += value;
+			features.columns[x] += value;
+			features.histogram[value >> 2]++;
+		}
+		features.rows[firstRow + y] = sum;
 	}
+}
+
+void VisualDetector::gatherFeatures(const uint8_t* gray, FrameFeatures& features){
+	memset(features.histogram, 0, sizeof(features.histogram));
+	std::fill(features.columns.begin(), features.columns.end(), 0);
+
+	for(size_t y = 0; y < features.height; y++){
+		const uint8_t* row = gray + y * features.width;
+
+		uint32_t sum = 0;
+		for(size_t x = 0; x < features.width; x++){
+			sum += row[x];
+			features.columns[x] += row[x];
+			features.histogram[row[x] >> 2]++;
+		}
+		features.rows[y] = sum;
+	}
+}
+
+bool VisualDetector::gate(const FrameFeatures& current, const FrameFeatures& reference, const Params& params){
+	const uint32_t pixels = current.width * current.height;
 
-	cv::resize(gray, frame1, frame1.size(), 0, 0, cv::InterpolationFlags::INTER_LINEAR);
+	//changes of the detected size and strength, all in the same direction, move the mean by threshold * cutoff
+	int64_t total = 0;
+	for(size_t y = 0; y < current.height; y++){
+		total += (int64_t) (current.rows[y] << 8) - reference.rows[y];
+	}
+	const float mean = total / (256.0f * pixels);
+	if(std::abs(mean) >= params.detectionThreshold * params.noiseCutoff / 2) return true;
+
+	//a square of that size shifts a sqrt(threshold) share of the rows and columns by sqrt(threshold) * cutoff
+	//against the rest of the frame, one noisy row or column doesn't
+	const float side = std::sqrt(params.detectionThreshold);
+	const auto band = [side, mean, &params](const std::vector<uint32_t>& cur, const std::vector<uint32_t>& ref, uint32_t length){
+		uint32_t shifted = 0;
+		for(size_t i = 0; i < cur.size(); i++){
+			const float change = ((int32_t) (cur[i] << 8) - (int32_t) ref[i]) / (256.0f * length);
+			shifted += std::abs(change - mean) >= side * params.noiseCutoff / 2;
+		}
+		return shifted >= side * cur.size() / 2;
+	};
+	if(band(current.rows, reference.rows, current.width) || band(current.columns, reference.columns, current.height)) return true;
+
+	//pixels that changed bins, brightening in one place while the exposure darkens the rest keeps the mean
+	uint32_t moved = 0;
+	for(size_t i = 0; i < HistogramBins; i++){
+		moved += std::abs((int32_t) (current.histogram[i] << 8) - (int32_t) reference.histogram[i]);
+	}
+	return moved / 512 >= pixels * params.detectionThreshold / 2;
+}
 
-	std::vector<uint8_t> diffFrame(ScaledWidth * ScaledHeight);
-	cv::Mat diff(ScaledHeight, ScaledWidth, CV_8U, diffFrame.data());
-	cv::absdiff(frame0, frame1, diff);
+void VisualDetector::updateReference(const FrameFeatures& current, FrameFeatures& reference, uint8_t shift){
+	const auto update = [shift](uint32_t cur, uint32_t& ref){
+		ref += ((int32_t) (cur << 8) - (int32_t) ref) >> shift;
+	};
 
-	cv::Mat denoisedDiff(ScaledHeight, ScaledWidth, CV_8U);
-	cv::threshold(diff, denoisedDiff, NoiseCutoff, 255, cv::ThresholdTypes::THRESH_TOZERO);
+	for(size_t i = 0; i < HistogramBins; i++){
+		update(current.histogram[i], reference.histogram[i]);
+	}
+	for(size_t i = 0; i < current.rows.size(); i++){
+		update(current.rows[i], reference.rows[i]);
+	}
+	for(size_t i = 0; i < current.columns.size(); i++){
+		update(current.columns[i], reference.columns[i]);
+	}
+}
 
-	const auto count = cv::countNonZero(denoisedDiff);
-	ESP_LOGD(TAG, "Diff pixel count: %d", count);
+void VisualDetector::updateRate(bool detected){
+	if(idleDivider <= 1) return;
 
-	cv::swap(frame0, frame1);
+	const uint64_t now = millis();
+	if(detected){
+		burstEnd = now + burstDuration;
+	}
 
-	if(count < DetectionPixelNum) return 0;
+	const uint8_t divider = now < burstEnd ? 1 : idleDivider;
+	if(divider == frameDivider) return;
 
+	if(!camera->setFrameDivider(divider)){
+		DLOGW(TAG, "Camera can't switch frame rate, staying at the full rate");
+		idleDivider = 1;
+		return;
+	}
 
-	const auto sum = cv::sum(denoisedDiff);
-	return (int) (sum[0] / count);
+	//the frame period follows the divider until it is measured at the new rate
+	framePeriod = framePeriod * divider / frameDivider;
+	frameDivider = divider;
+	dividerSwitched = micros();
+	windowPeriod = UINT32_MAX;
+	windowFrames = 0;
 }
 
-void VisualDetector::storeShots(){
-	uint8_t* out;
-	size_t len;
+void VisualDetector::rowChanges(const FrameFeatures& current, const FrameFeatures& reference, float* changes){
+	const float scale = 1.0f / (256.0f * current.width);
+	for(size_t y = 0; y < current.height; y++){
+		changes[y] = ((int32_t) (current.rows[y] << 8) - (int32_t) reference.rows[y]) * scale;
+	}
+}
 
-	if(!fmt2jpg(frame0.data, frame0.cols * frame0.rows, frame0.cols, frame0.rows, PIXFORMAT_GRAYSCALE, 30, &out, &len)){
-		ESP_LOGE(TAG, "frame2jpg conversion failed.");
+int32_t VisualDetector::findBand(const float* changes, size_t rows, float level, bool toBottom){
+	if(toBottom){
+		size_t top = rows;
+		while(top > 0 && changes[top - 1] >= level){
+			top--;
+		}
+		return top < rows ? (int32_t) top : -1;
 	}
 
-	std::string name_b = "/sd/" + std::to_string(lastShotTimestamp) + "_b.jpg";
-	std::string name_a = "/sd/" + std::to_string(lastShotTimestamp) + "_a.jpg";
+	for(size_t y = 0; y + 1 < rows; y++){
+		if(changes[y] >= level && changes[y + 1] >= level) return (int32_t) y;
+	}
+	return -1;
+}
+
+void VisualDetector::scale(const ImageView& src, const ImageView& dst){
+	Image::resize(src, dst);
+}
 
-	FILE* file = fopen(name_b.c_str(), "w");
-	if(!file){
-		ESP_LOGE(TAG, "error opening file on SD!\n");
+void VisualDetector::initBackground(const uint8_t* frame, BackgroundPixel* background, size_t pixels){
+	for(size_t i = 0; i < pixels; i++){
+		background[i] = { (uint16_t) (frame[i] << 8), InitialVariance };
 	}
-	size_t written = fwrite(out, 1, len, file);
-	ESP_LOGD(TAG, "written %d to %s\n", written, name_b.c_str());
+}
 
-	fclose(file);
+uint32_t VisualDetector::updateBackground(const uint8_t* frame, BackgroundPixel* background, size_t pixels, const Params& params, uint32_t& sum,
+										  uint8_t* mask, bool lasting){
+	//squared deviation has 8 fractional bits, the variance 4, sigma^2 makes up the difference
+	const uint32_t sigmaSq = params.deviationSigma * params.deviationSigma * 16 + 0.5f;
+	const uint32_t cutoff = params.noiseCutoff << 8;
+	const uint8_t shift = params.backgroundShift, slowShift = lasting ? shift : params.backgroundShift + ForegroundShift;
+
+	uint32_t count = 0;
+	sum = 0;
+
+	//the frame read once, the model read and written once: 9 B per pixel, what absdiff, threshold and count moved
+	for(size_t i = 0; i < pixels; i++){
+		BackgroundPixel pixel = background[i];
+		const int32_t deviation = (frame[i] << 8) - pixel.mean; //[8.8]
+		const uint32_t magnitude = std::abs(deviation);
+		const uint32_t squared = (magnitude >> 4) * (magnitude >> 4); //[16.8]
+
+		const bool deviates = magnitude > cutoff && squared > sigmaSq * pixel.variance;
+		if(mask){
+			mask[i] = deviates ? 255 : 0;
+		}
 
-	free(out);
+		if(deviates){
+			count++;
+			sum += magnitude >> 8;
+			pixel.mean += deviation >> slowShift;
+		}else{
+			pixel.mean += deviation >> shift;
+			const int32_t variance = pixel.variance + (((int32_t) (squared >> 4) - pixel.variance) >> shift);
+			pixel.variance = std::min<int32_t>(variance, UINT16_MAX);
+		}
 
-	if(!fmt2jpg(frame1.data, frame1.cols * frame1.rows, frame1.cols, frame1.rows, PIXFORMAT_GRAYSCALE, 30, &out, &len)){
-		ESP_LOGE(TAG, "frame2jpg conversion failed.");
+		background[i] = pixel;
 	}
 
-	file = fopen(name_a.c_str(), "w");
-	if(!file){
-		ESP_LOGE(TAG, "error opening file on SD!\n");
+	return count;
+}
+
+void VisualDetector::describeChange(const ImageView& mask, uint8_t* cells, ComponentLabeller& labeller, VideoEvent& event){
+	const ImageView reduced(cells, mask.width / CellSize, mask.height / CellSize);
+	Image::downscaleBox(mask, reduced);
+	Image::threshold(cells, cells, reduced.pixels(), CellLevel, 255);
+
+	event.regions = std::min<size_t>(labeller.label(reduced), UINT8_MAX);
+	event.coverage = std::max<size_t>(Image::countNonZero(cells, reduced.pixels()) * 255 / reduced.pixels(), event.regions ? 1 : 0);
+
+	if(labeller.size() == 0){
+		event.left = event.top = event.right = event.bottom = 0;
+		event.elongation = 0;
+		return;
 	}
-	written = fwrite(out, 1, len, file);
-	ESP_LOGD(TAG, "written %d to %s\n", written, name_a.c_str());
 
-	fclose(file);
+	const auto& largest = labeller.components()[0];
+	event.left = largest.left * CellSize;
+	event.top = largest.top * CellSize;
+	event.right = (largest.right + 1) * CellSize - 1;
+	event.bottom = (largest.bottom + 1) * CellSize - 1;
+	event.elongation = largest.elongation;
+}
 
+void VisualDetector::storeShots(const camera_fb_t* frameData){
+	TraceSpan span(TraceId::StoreShots);
+
+	//the background is the scene before the change
+	RegionBuffer<uint8_t> before(Memory::Region::Bulk, background.size(), "shot");
+	if(before.size() == 0) return;
+	for(size_t i = 0; i < before.size(); i++){
+		before[i] = background[i].mean >> 8;
+	}
+
+	//raw frames into the ring if there is one, no JPEG encoding and no FAT updates
+	if(RingLog::frame(frameStart / 1000, before.data(), FrameWidth, FrameHeight) &&
+	   RingLog::frame(frameStart / 1000, grayFrame.data(), FrameWidth, FrameHeight)){
+		return;
+	}
+
+	storeShot(before.data(), "b");
+
+	//at full resolution straight from the camera in JPEG mode
+	if(frameData->format == PIXFORMAT_JPEG){
+		writeShot(frameData->buf, frameData->len, "a");
+	}else{
+		storeShot(grayFrame.data(), "a");
+	}
+}
+
+void VisualDetector::storeShot(const uint8_t* pixels, const char* suffix){
+	uint8_t* out;
+	size_t len;
+
+	if(!fmt2jpg((uint8_t*) pixels, FrameWidth * FrameHeight, FrameWidth, FrameHeight, PIXFORMAT_GRAYSCALE, ShotQuality, &out, &len)){
+		ESP_LOGE(TAG, "frame2jpg conversion failed.");
+		return;
+	}
+
+	writeShot(out, len, suffix);
 	free(out);
 }
+
+void VisualDetector::writeShot(const uint8_t* data, size_t len, const char* suffix){
+	std::string name = "/sd/" + std::to_string(frameStart / 1000) + "_" + suffix + ".jpg";
+
+	//the JPEG is in PSRAM, the writer copies it into its DMA buffer and writes it in whole sectors
+	if(shotWriter.open(name.c_str())){
+		Trace::begin(TraceId::SDWrite);
+		shotWriter.write(data, len);
+		shotWriter.close();
+		Trace::end(TraceId::SDWrite, len);
+		ESP_LOGD(TAG, "written %zu to %s", len, name.c_str());
+	}
+}
@@ -2,58 +2,276 @@
 #define THUNDER_DETECTOR_VISUALDETECTOR_H
 
 #include "Util/Threaded.h"
-#include "Devices/Camera.h"
-#include "Periph/SD.h"
+#include "Devices/FrameSource.h"
 #include "Util/Queue.h"
 #include "SensorEvent.hpp"
-
-#undef EPS
-
-#include <opencv2/core/mat.hpp>
+#include "SceneCalibration.h"
+#include "Periph/SDWriter.h"
+#include "Util/JpegDc.h"
+#include "Util/Memory.h"
+#include "Util/TileStream.h"
+#include "Util/Image.h"
+#include "Util/ComponentLabeller.h"
+#include <memory>
+#include <vector>
 
 
 class VisualDetector : public Threaded {
 public:
-	VisualDetector(Camera* cam, Queue<SensorEvent>* queue = nullptr);
+	VisualDetector(FrameSource* cam, Queue<SensorEvent>* queue = nullptr);
+
+	//Enables storing JPEG shots of detected changes to SD, on by default
+	void setStoreShots(bool store);
+
+	/**
+	 * Runs the camera at 1 / idleDivider of its frame rate and at the full rate for 'duration' after every detection,
+	 * off by default. Stays at the full rate if the camera can't switch (FrameSource::setFrameDivider).
+	 * @param duration [ms]
+	 */
+	void setBurst(uint8_t idleDivider, uint32_t duration);
+
+	//Detection thresholds, tunable offline with the host batch replay
+	struct Params {
+		//Noise cutoff when determining difference between frames
+		uint8_t noiseCutoff = 10;
+
+		/**
+		 * Percentage of image pixels that need to deviate from the background to indicate a lightning strike
+		 * Should be in approximate range of 0.2 - 0.01
+		 */
+		float detectionThreshold = 0.1f;
+
+		//A pixel also has to be this many standard deviations of its own noise away from the background
+		float deviationSigma = 3.0f;
+
+		//The background follows each frame with weight 1 / 2^backgroundShift, 4 is a time constant of 16 frames
+		uint8_t backgroundShift = 4;
+
+		//Compare frames with the background only when their global features changed, see gate(). Not equivalent to
+		//comparing every frame: the background model of quiet frames is updated by rows (QuietRowStride), so
+		//detections differ a little, batch -s gates=0:1:1 measures by how much
+		bool gates = true;
+
+		//Scale the thresholds and set the sensor's exposure by the scene (day, dusk, night), see SceneCalibration
+		bool calibrate = false;
+	};
+
+	void setParams(const Params& params);
+	const Params& getParams() const;
+
+	//Thresholds detection runs with, 'params' adjusted to the scene
+	const Params& getTuned() const;
+	SceneCalibration::Scene getScene() const;
+
+	//Detection kernels, separate so examples/benchmark.cpp can time them on their own
+
+	//Camera RGB565 (big-endian per pixel) to 8-bit grayscale
+	static void rgb565ToGray(const uint8_t* rgb565, uint8_t* gray, size_t pixels);
+
+	static constexpr size_t HistogramBins = 64;
+
+	//Global luminance of a frame: its histogram and the sums of every row and column
+	struct FrameFeatures {
+		FrameFeatures(uint16_t width, uint16_t height) : width(width), height(height), rows(height), columns(width){}
+
+		uint16_t width, height;
+		uint32_t histogram[HistogramBins];
+		std::vector<uint32_t> rows, columns;
+	};
+
+	//rgb565ToGray that also gathers the features of the frame, in the same pass
+	static void rgb565ToGray(const uint8_t* rgb565, uint8_t* gray, FrameFeatures& features);
+
+	//The same for 'rows' rows from 'firstRow' on, 'rgb565' and 'gray' point to the first of them. Call in row order.
+	static void rgb565ToGray(const uint8_t* rgb565, uint8_t* gray, FrameFeatures& features, size_t firstRow, size_t rows);
+
+	//Features of a grayscale frame
+	static void gatherFeatures(const uint8_t* gray, FrameFeatures& features);
+
+	/**
+	 * Tests whether 'current' moved far enough from 'reference' (features scaled by 256) for the frame to possibly
+	 * hold a detection: a mean step, a row or column changing more than the rest, or pixels moving between
+	 * histogram bins. The limits follow from params.detectionThreshold and params.noiseCutoff.
+	 */
+	static bool gate(const FrameFeatures& current, const FrameFeatures& reference, const Params& params);
+
+	//Moves 'reference' towards 'current' with weight 1 / 2^shift
+	static void updateReference(const FrameFeatures& current, FrameFeatures& reference, uint8_t shift);
+
+	//Mean brightness change of every row of 'current' against 'reference' (scaled by 256)
+	static void rowChanges(const FrameFeatures& current, const FrameFeatures& reference, float* changes);
+
+	/**
+	 * Top row of a band of rows that changed by at least 'level': the first two such rows in a row, or with
+	 * 'toBottom' the top of the band reaching the last row
+	 * @return -1 if there is none
+	 */
+	static int32_t findBand(const float* changes, size_t rows, float level, bool toBottom);
+
+	//Bilinear resize of 'src' to the size of 'dst'
+	static void scale(const ImageView& src, const ImageView& dst);
+
+	//Running per-pixel mean and variance of the scene, 8.8 and 12.4 fixed-point
+	struct BackgroundPixel {
+		uint16_t mean;
+		uint16_t variance;
+	};
+
+	//Seeds the background with 'frame'
+	static void initBackground(const uint8_t* frame, BackgroundPixel* background, size_t pixels);
+
+	/**
+	 * Compares 'frame' with the background and updates the background in the same pass. Pixels that deviate
+	 * follow much slower, so a flash spanning several frames isn't absorbed into the background.
+	 * @param sum receives the summed deviation of the deviating pixels
+	 * @param mask if not null, receives 255 for every deviating pixel and 0 for the rest
+	 * @param lasting the change has outlasted a flash (LastingFrames), deviating pixels follow at the normal rate
+	 * @return number of pixels deviating by more than params.noiseCutoff and params.deviationSigma
+	 */
+	static uint32_t updateBackground(const uint8_t* frame, BackgroundPixel* background, size_t pixels, const Params& params, uint32_t& sum,
+									 uint8_t* mask = nullptr, bool lasting = false);
+
+	static constexpr uint32_t CellSize = 4; //change mask cells are CellSize x CellSize pixels
+	static constexpr uint8_t CellLevel = 255 / 4; //a cell has changed when over a quarter of its pixels deviate
+
+	/**
+	 * Shape of a change: 'mask' of deviating pixels (updateBackground) reduced to 'cells' and split into connected
+	 * regions by 'labeller'
+	 * @param cells width / CellSize x height / CellSize
+	 */
+	static void describeChange(const ImageView& mask, uint8_t* cells, ComponentLabeller& labeller, VideoEvent& event);
+
+	static constexpr uint8_t ShotQuality = 30; //JPEG quality of stored shots
+
+	static constexpr uint32_t FrameWidth = 160, FrameHeight = 120; //160x120 resolution
 
 protected:
 	void loop() override;
 
 private:
-	Camera* camera;
+	FrameSource* camera;
 	Queue<SensorEvent>* outputQueue = nullptr;
 	bool initialFill = false;
+	bool storeEnabled = true;
+
+	//read and written every frame, kept in internal RAM
+	RegionBuffer<uint8_t> grayFrame;
+	RegionBuffer<BackgroundPixel> background;
+
+	//written only on frames past the gates
+	RegionBuffer<uint8_t> changeMask;
+	uint8_t changeCells[(FrameWidth / CellSize) * (FrameHeight / CellSize)];
+	static_assert(FrameWidth / CellSize <= ComponentLabeller::MaxWidth);
+	ComponentLabeller labeller;
+	VideoEvent change{}; //of the last detection
+
+	//RGB565 camera frames are in PSRAM, converted from internal tiles
+	TileStream tiles{ FrameWidth * 2, TileRows, "frame tiles" };
+
+	FrameFeatures features{ FrameWidth, FrameHeight };
+	FrameFeatures reference{ FrameWidth, FrameHeight }; //running average of 'features', scaled by 256
+	uint32_t quietFrames = 0;
+
+	std::vector<float> changes, previousChanges; //rowChanges() of this frame and the one before
+	uint64_t frameStart = 0, previousFrameStart = 0; //[us] camera->frameTime(), shots are named by it in [ms]
+	uint32_t framePeriod = 0; //[us] 0 until measured
+	uint32_t windowPeriod = UINT32_MAX, windowFrames = 0;
+	uint64_t flashTimestamp = 0; //[us] of the last detection
+	uint32_t detectedFrames = 0; //in a row
+	uint32_t previousCount = 0; //deviating pixels of the last detected frame
+	bool armed = true; //an event is posted at the onset of a change, the next one after a quiet frame or a flash
 
-	cv::Mat frame0, frame1;
-	std::unique_ptr<uint8_t> frame0Data, frame1Data;
-	size_t lastShotTimestamp = 0;
+	uint8_t idleDivider = 1, frameDivider = 1;
+	uint32_t burstDuration = 0; //[ms]
+	uint64_t burstEnd = 0; //[ms]
+	uint64_t dividerSwitched = 0; //[us] frames before it are ignored by trackFrameTime()
+
+	//Switches between the idle and the burst frame rate
+	void updateRate(bool detected);
+
+	//Frames the detector was too slow for are skipped, the frame period is the shortest spacing within a window
+	void trackFrameTime(const camera_fb_t* frameData);
+
+	/**
+	 * Rolling shutter: the sensor reads the rows out one after another and each row exposes until it is read out,
+	 * so a flash starting within a frame only brightens the rows read out after it. The first of them dates the
+	 * flash to a row time, a fraction of a millisecond. A band already at the top row started at the bottom of the
+	 * frame before, where it was too small for a detection.
+	 * @return [us] of the flash, the start of the frame if there is no band
+	 */
+	uint64_t flashTime() const;
 
 	/**
-	 * @param frameData
+	 * @param frameData RGB565, grayscale or JPEG
 	 * @return 0 if none detected, otherwise a positive integer that indicates the change intensity
 	 */
 	int detectLightning(camera_fb_t* frameData);
 
-	void storeShots();
+	//JPEG frames are detected on their 1/8 scale luminance, created with the first one
+	std::unique_ptr<JpegDcDecoder> jpegDc;
+	bool jpegToGray(const camera_fb_t* frameData, uint8_t* gray);
 
+	//The background before and the current frame after, the full camera JPEG replaces the latter when there is one
+	void storeShots(const camera_fb_t* frameData);
+	void storeShot(const uint8_t* pixels, const char* suffix);
+	void writeShot(const uint8_t* data, size_t len, const char* suffix);
+	SDWriter shotWriter{ 8 * 1024 };
 
-	//Noise cutoff when determining difference between frames
-	static constexpr uint8_t NoiseCutoff = 10;
+	Params params;
+	Params tuned; //params for the current scene
+	uint32_t detectionPixelNum; //pixels that need to change, derived from tuned.detectionThreshold
 
-	//Scale factor when calculating the difference between frames (for memory and time efficiency)
-	static constexpr float Scale = 1.0f;
+	//Noise cutoff relative to params and the sensor settings of every SceneCalibration::Scene, the area threshold
+	//stays as configured
+	struct SceneProfile {
+		float cutoffScale;
+		FrameSource::SensorProfile sensor;
+	};
+	static constexpr SceneProfile Profiles[] = {
+			//day: clouds and glare move, lower exposure keeps a flash from saturating
+			{ 1.5f, { false, 0, 0, -1, 1 }},
+			//dusk: as configured
+			{ 1.0f, { false, 0, 0, 0, 3 }},
+			//night: fixed long exposure, a flash still stands out of a dark scene by a few levels
+			{ 0.8f, { true, 1200, 12, 0, 4 }}
+	};
 
-	/**
-	 * Percentage of image pixels that need to change between two frames to indicate a lightning strike
-	 * Should be in approximate range of 0.2 - 0.01
-	 */
-	static constexpr float DetectionThreshold = 0.1f;
+	SceneCalibration calibration;
+	float exposureScale = 1; //exposure time share * gain, the last read from the camera
+	uint32_t calibrationFrames = 0;
+	uint32_t settleFrames = 0; //the background is reseeded while the sensor adjusts to a new profile
 
-	static constexpr uint32_t FrameWidth = 160, FrameHeight = 120; //160x120 resolution
-	static constexpr uint32_t ScaledWidth = FrameWidth * Scale;
-	static constexpr uint32_t ScaledHeight = FrameHeight * Scale;
+	//Follows the scene on frames without a detection, switching the thresholds and the sensor profile
+	void calibrate();
+
+	//tuned and detectionPixelNum from params, the scene and the measured noise
+	void applyScene();
+
+	static constexpr uint32_t ExposurePeriod = 20; //[frames] between reads of the exposure registers
+	static constexpr uint32_t SettleFrames = 10;
+	static constexpr float NoiseCutoffFactor = 3; //the cutoff doesn't go under this many deviations of the frame noise
+	static constexpr float MedianDeviation = 0.6745f; //median absolute deviation of normal noise, in deviations
+
+	static constexpr uint16_t InitialVariance = 4 << 4; //[12.4], sigma of 2 until the noise is learned
+	static constexpr uint8_t ForegroundShift = 3; //deviating pixels follow 2^3 times slower
+
+	//A change detected in more frames in a row than a flash lasts (400 ms at 20 fps) is the scene changing, e.g.
+	//headlights or a gain step, and is absorbed into the background at the normal rate
+	static constexpr uint32_t LastingFrames = 10;
+
+	//Over a lasting change, a flash at least multiplies the deviating pixels by this
+	static constexpr uint32_t FlashGrowth = 2;
+
+	//Frames that don't pass the gates update every 4th row of the background, 4 times faster. The gate reference
+	//always follows that fast, so slow changes of the scene don't keep the gates open.
+	static constexpr uint32_t QuietRowStride = 4;
+	static constexpr uint8_t QuietShift = 2;
+
+	static constexpr float ReadoutShare = 0.9f; //of the frame period the rows are read out in, the rest is vertical blanking
+	static constexpr float OnsetFloor = 1.0f; //smallest row change in a band, 5 times the noise of a row mean
+	static constexpr uint32_t PeriodWindow = 100; //[frames]
 
-	static constexpr uint32_t DetectionPixelNum = ScaledHeight * ScaledWidth * DetectionThreshold;
+	static constexpr size_t TileRows = 8; //2.5 kB of RGB565 per tile
 
 };
 